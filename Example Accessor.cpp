@@ -0,0 +1,74 @@
+#include "Streamable.hpp"
+
+using namespace hbann;
+
+#include <iostream>
+
+using namespace std;
+
+enum class Status : uint8_t
+{
+    Queued,
+    Running,
+    Done
+};
+
+class Job : public IStreamable
+{
+    ISTREAMABLE_DEFINE(Job, mID, mName, mArguments, mStatus, mProgress);
+
+  public:
+    Job() = default;
+
+    Job(const uint64_t aID, const string &aName, const vector<string> &aArguments)
+        : mID(aID), mName(aName), mArguments(aArguments)
+    {
+    }
+
+    void Finish()
+    {
+        mStatus = Status::Done;
+        mProgress = 100;
+    }
+
+    bool operator==(const Job &aJob) const
+    {
+        return mID == aJob.mID && mName == aJob.mName && mArguments == aJob.mArguments && mStatus == aJob.mStatus &&
+               mProgress == aJob.mProgress;
+    }
+
+  private:
+    uint64_t mID{};
+    string mName{};
+    vector<string> mArguments{};
+    Status mStatus{};
+    uint32_t mProgress{};
+};
+
+// the status and the progress are found after the variable size objects and overwritten in the stream
+bool round_trip(Job &aJob)
+{
+    using JobAccessor = StreamableAccessor<Job>;
+
+    auto stream = aJob.ToStream();
+    const auto status = JobAccessor::ReadObject<3>(stream);
+    JobAccessor::WriteObject<3>(stream, Status::Done);
+    JobAccessor::WriteObject<4>(stream, uint32_t(100));
+
+    Job replica(move(stream));
+    aJob.Finish();
+    const auto equal = status == Status::Queued && replica == aJob;
+
+    cout << "The replica finished in place is " << (equal ? "equal" : "different") << endl;
+
+    return equal;
+}
+
+int main()
+{
+    Job job(7, "backup", {"--full", "/home"});
+    Job jobEmpty(8, "", {});
+
+    const auto equal = round_trip(job) & round_trip(jobEmpty);
+    return equal ? 0 : 1;
+}
@@ -0,0 +1,75 @@
+#include "Streamable.hpp"
+
+using namespace hbann;
+
+#include <iostream>
+
+using namespace std;
+
+struct Point
+{
+    double x;
+    double y;
+
+    bool operator==(const Point &aPoint) const = default;
+};
+
+class Shape : public IStreamable
+{
+    ISTREAMABLE_DEFINE(Shape, mID, mName, mOrigin, mPoints, mLabels);
+
+  public:
+    Shape() = default;
+
+    Shape(const uint32_t aID, const string &aName, const Point &aOrigin, const vector<Point> &aPoints,
+          const vector<string> &aLabels)
+        : mID(aID), mName(aName), mOrigin(aOrigin), mPoints(aPoints), mLabels(aLabels)
+    {
+    }
+
+    bool operator==(const Shape &aShape) const
+    {
+        return mID == aShape.mID && mName == aShape.mName && mOrigin == aShape.mOrigin && mPoints == aShape.mPoints &&
+               mLabels == aShape.mLabels;
+    }
+
+    const vector<Point> &GetPoints() const
+    {
+        return mPoints;
+    }
+
+  private:
+    uint32_t mID{};
+    string mName{};
+    Point mOrigin{};
+    vector<Point> mPoints{};
+    vector<string> mLabels{};
+};
+
+// the view reads the objects in place and the replica deserializes all of them
+bool round_trip(Shape &aShape)
+{
+    const auto stream = StreamableAligned::ToStream(aShape);
+
+    const StreamableAligned::View<Shape> view(stream);
+    const auto points = view.Get<3>();
+    const auto sameView = view.Get<0>() == 42 && equal(points.begin(), points.end(), aShape.GetPoints().begin(),
+                                                        aShape.GetPoints().end());
+
+    Shape replica;
+    StreamableAligned::Read(stream, replica);
+    const auto same = sameView && replica == aShape;
+
+    cout << "The replica of " << stream.size() << " aligned bytes is " << (same ? "equal" : "different") << endl;
+
+    return same;
+}
+
+int main()
+{
+    Shape shape(42, "triangle", {1., 2.}, {{0., 0.}, {1., 0.}, {0., 1.}}, {"a", "b", "c"});
+    Shape shapeEmpty(42, "", {}, {}, {});
+
+    const auto equal = round_trip(shape) & round_trip(shapeEmpty);
+    return equal ? 0 : 1;
+}
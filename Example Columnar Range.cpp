@@ -0,0 +1,84 @@
+#include "Streamable.hpp"
+
+using namespace hbann;
+
+#include <iostream>
+
+using namespace std;
+
+class Trade : public IStreamable
+{
+    ISTREAMABLE_DEFINE(Trade, mID, mSymbol, mPrice);
+
+  public:
+    Trade() = default;
+
+    Trade(const uint64_t aID, const string &aSymbol, const double aPrice) : mID(aID), mSymbol(aSymbol), mPrice(aPrice)
+    {
+    }
+
+    bool operator==(const Trade &aTrade) const
+    {
+        return mID == aTrade.mID && mSymbol == aTrade.mSymbol && mPrice == aTrade.mPrice;
+    }
+
+  private:
+    uint64_t mID{};
+    string mSymbol{};
+    double mPrice{};
+};
+
+class Trades : public IStreamable
+{
+    ISTREAMABLE_DEFINE(Trades, mTrades, mVenue);
+
+  public:
+    Trades() = default;
+
+    Trades(const string &aVenue) : mVenue(aVenue)
+    {
+    }
+
+    ColumnarRange<vector<Trade>> &GetTrades()
+    {
+        return mTrades;
+    }
+
+    bool operator==(const Trades &aTrades) const
+    {
+        return mTrades == aTrades.mTrades && mVenue == aTrades.mVenue;
+    }
+
+  private:
+    ColumnarRange<vector<Trade>> mTrades{}; // first, so the stream starts with the columnar range
+    string mVenue{};
+};
+
+bool round_trip(Trades &aTrades)
+{
+    auto stream = aTrades.ToStream();
+
+    // the prices are a contiguous column in the stream that can be read without decoding the trades
+    const auto prices = ColumnarRange<vector<Trade>>::ReadColumn<2>(stream);
+
+    Trades replica(move(stream));
+    const auto equal = replica == aTrades && prices.size() == aTrades.GetTrades().size();
+
+    cout << "The replica of " << aTrades.GetTrades().size() << " trades is " << (equal ? "equal" : "different")
+         << endl;
+
+    return equal;
+}
+
+int main()
+{
+    Trades trades("XNAS");
+    trades.GetTrades().emplace_back(1, "AAPL", 189.25);
+    trades.GetTrades().emplace_back(2, "MSFT", 402.5);
+    trades.GetTrades().emplace_back(3, "", 0.);
+
+    Trades tradesEmpty("XLON");
+
+    const auto equal = round_trip(trades) & round_trip(tradesEmpty);
+    return equal ? 0 : 1;
+}
@@ -0,0 +1,205 @@
+#include "StreamableAsync.hpp"
+
+using namespace hbann;
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <iostream>
+
+using namespace std;
+using namespace chrono;
+
+constexpr size_t chunk_size = 64 * 1024;
+
+class Order : public IStreamable
+{
+    ISTREAMABLE_DEFINE(Order, mID, mSymbol, mPrices);
+
+  public:
+    Order() = default;
+
+    Order(const uint64_t aID, const string &aSymbol, const vector<double> &aPrices)
+        : mID(aID), mSymbol(aSymbol), mPrices(aPrices)
+    {
+    }
+
+    void SetSymbol(const string &aSymbol)
+    {
+        mSymbol = aSymbol;
+    }
+
+    bool operator==(const Order &aOrder) const
+    {
+        return mID == aOrder.mID && mSymbol == aOrder.mSymbol && mPrices == aOrder.mPrices;
+    }
+
+  private:
+    uint64_t mID{};
+    string mSymbol{};
+    vector<double> mPrices{};
+};
+
+class Book : public IStreamable
+{
+    ISTREAMABLE_DEFINE(Book, mName, mOrders);
+
+  public:
+    Book() = default;
+
+    Book(const string &aName, const vector<Order> &aOrders) : mName(aName), mOrders(aOrders)
+    {
+    }
+
+    vector<Order> &GetOrders()
+    {
+        return mOrders;
+    }
+
+    bool operator==(const Book &aBook) const
+    {
+        return mName == aBook.mName && mOrders == aBook.mOrders;
+    }
+
+  private:
+    string mName{};
+    vector<Order> mOrders{};
+};
+
+// a single threaded event loop that runs every handler once per iteration until all of them finished
+class EventLoop
+{
+  public:
+    void Add(function<bool()> aHandler)
+    {
+        mHandlers.push_back(move(aHandler));
+    }
+
+    // returns the longest time between two iterations
+    nanoseconds Run()
+    {
+        nanoseconds stallMax{};
+        auto last = steady_clock::now();
+        while (!mHandlers.empty())
+        {
+            for (size_t i = 0; i < mHandlers.size();)
+            {
+                if (mHandlers[i]())
+                {
+                    mHandlers.erase(mHandlers.begin() + i);
+                }
+                else
+                {
+                    i++;
+                }
+            }
+
+            const auto now = steady_clock::now();
+            stallMax = max<nanoseconds>(stallMax, now - last);
+            last = now;
+        }
+
+        return stallMax;
+    }
+
+  private:
+    deque<function<bool()>> mHandlers;
+};
+
+Book make_book()
+{
+    vector<Order> orders;
+    for (uint64_t i = 0; i < 200'000; i++)
+    {
+        orders.emplace_back(i, "EURUSD", vector<double>(16, 1.0842));
+    }
+
+    return Book("EURUSD book", orders);
+}
+
+void blocking(Book &aBook)
+{
+    EventLoop loop;
+    Book replica;
+    loop.Add([&] {
+        // the whole book is encoded and decoded in a single iteration
+        replica = Book(aBook.ToStream());
+        return true;
+    });
+
+    const auto stallMax = loop.Run();
+    cout << "Blocking: longest stall " << duration_cast<microseconds>(stallMax).count()
+         << " us, replica is " << (replica == aBook ? "equal" : "different") << endl;
+}
+
+void coroutines(Book &aBook)
+{
+    EventLoop loop;
+    deque<vector<uint8_t>> socket; // the chunks sent but not received yet
+
+    auto chunks = StreamableEncoder::Encode(aBook, chunk_size);
+    auto chunk = chunks.begin();
+    loop.Add([&] {
+        if (chunk == chunks.end())
+        {
+            return true;
+        }
+
+        // the chunk is valid until the generator is resumed so it's copied to the socket
+        socket.emplace_back((*chunk).begin(), (*chunk).end());
+        ++chunk;
+        return false;
+    });
+
+    Book replica;
+    StreamableDecoder decoder(replica);
+    auto task = decoder.Decode();
+    task.Start();
+    loop.Add([&] {
+        if (!socket.empty())
+        {
+            decoder.Feed(socket.front());
+            socket.pop_front();
+        }
+
+        return task.IsDone();
+    });
+
+    size_t ticks{};
+    loop.Add([&] {
+        // other I/O that runs between the chunks
+        ticks++;
+        return task.IsDone();
+    });
+
+    const auto stallMax = loop.Run();
+    cout << "Coroutines: longest stall " << duration_cast<microseconds>(stallMax).count() << " us, " << ticks
+         << " ticks, replica is " << (replica == aBook ? "equal" : "different") << endl;
+}
+
+// the chunks must be the same as ToStream even after the book was encoded and then modified
+void modified(Book &aBook)
+{
+    aBook.ToStream();
+    aBook.GetOrders().front().SetSymbol("EURUSD.FUTURES.2026");
+
+    vector<uint8_t> chunks;
+    for (const auto chunk : StreamableEncoder::Encode(aBook, chunk_size))
+    {
+        chunks.insert(chunks.end(), chunk.begin(), chunk.end());
+    }
+
+    const auto &stream = aBook.ToStream();
+    cout << "Modified: the chunks are " << (chunks == stream ? "equal" : "different") << " to ToStream()" << endl;
+}
+
+int main()
+{
+    auto book = make_book();
+
+    blocking(book);
+    coroutines(book);
+    modified(book);
+
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include "Streamable.hpp"
+
+using namespace hbann;
+
+#include <iostream>
+
+using namespace std;
+
+class Series : public IStreamable
+{
+    ISTREAMABLE_DEFINE(Series, mTimestamps, mChanges);
+
+  public:
+    Series() = default;
+
+    DeltaRange<vector<uint64_t>> &GetTimestamps()
+    {
+        return mTimestamps;
+    }
+
+    DeltaRange<vector<int32_t>> &GetChanges()
+    {
+        return mChanges;
+    }
+
+    bool operator==(const Series &aSeries) const
+    {
+        return mTimestamps == aSeries.mTimestamps && mChanges == aSeries.mChanges;
+    }
+
+  private:
+    DeltaRange<vector<uint64_t>> mTimestamps{}; // sorted, so the deltas need just a few bits
+    DeltaRange<vector<int32_t>> mChanges{};     // signed, so the deltas may be negative
+};
+
+bool round_trip(Series &aSeries)
+{
+    auto stream = aSeries.ToStream();
+    const auto size = stream.size();
+
+    Series replica(move(stream));
+    const auto equal = replica == aSeries;
+
+    cout << "The replica of " << aSeries.GetTimestamps().size() << " timestamps and " << aSeries.GetChanges().size()
+         << " changes in " << size << " bytes is " << (equal ? "equal" : "different") << endl;
+
+    return equal;
+}
+
+// fills a series whose timestamps start at a big value and whose changes go up and down
+Series make_series(const size_t aCount)
+{
+    Series series;
+
+    uint64_t timestamp = 1700000000000000000;
+    for (size_t i = 0; i < aCount; i++)
+    {
+        timestamp += 1000 + i % 7;
+        series.GetTimestamps().push_back(timestamp);
+        series.GetChanges().push_back(i % 2 ? -int32_t(i * 3) : int32_t(i));
+    }
+
+    return series;
+}
+
+int main()
+{
+    // the deltas are packed in blocks of 128, so the last block is full or has a single delta
+    auto series128 = make_series(128);
+    auto series129 = make_series(129);
+    auto seriesEmpty = make_series(0);
+
+    // the widest deltas of a signed type
+    Series seriesExtremes;
+    seriesExtremes.GetTimestamps() = {UINT64_MAX, 0, UINT64_MAX};
+    seriesExtremes.GetChanges() = {INT32_MAX, INT32_MIN, INT32_MAX, -1, 0};
+
+    const auto equal = round_trip(series128) & round_trip(series129) & round_trip(seriesEmpty) &
+                       round_trip(seriesExtremes);
+    return equal ? 0 : 1;
+}
@@ -0,0 +1,79 @@
+#define ISTREAMABLE_INSTRUMENTATION
+#include "Streamable.hpp"
+
+using namespace hbann;
+
+#include <iostream>
+#include <thread>
+
+using namespace std;
+
+constexpr size_t encodes_count = 100; // per thread
+
+class Price : public IStreamable
+{
+    ISTREAMABLE_DEFINE(Price, mBid, mAsk);
+
+  public:
+    Price() = default;
+
+    Price(const double aBid, const double aAsk) : mBid(aBid), mAsk(aAsk)
+    {
+    }
+
+  private:
+    double mBid{};
+    double mAsk{};
+};
+
+class Quote : public IStreamable
+{
+    ISTREAMABLE_DEFINE(Quote, mSymbol, mPrices);
+
+  public:
+    Quote() = default;
+
+    Quote(const string &aSymbol, const vector<Price> &aPrices) : mSymbol(aSymbol), mPrices(aPrices)
+    {
+    }
+
+  private:
+    string mSymbol{};
+    vector<Price> mPrices{};
+};
+
+void encode_and_decode(Quote &aQuote, size_t &aBytes)
+{
+    for (size_t i = 0; i < encodes_count; i++)
+    {
+        auto stream = aQuote.ToStream();
+        aBytes = stream.size();
+        Quote replica(move(stream));
+    }
+}
+
+int main()
+{
+    Quote quote("EURUSD", vector<Price>(8, Price(1.0841, 1.0843)));
+
+    size_t bytes{};
+    encode_and_decode(quote, bytes);
+    thread([&] {
+        size_t bytesThread{};
+        encode_and_decode(quote, bytesThread);
+    }).join();
+
+    // every quote has 8 nested prices that are counted for their own type too
+    const auto counters = StreamableInstrumentation::Aggregate();
+    const auto &quotes = counters.at(typeid(Quote));
+    const auto &prices = counters.at(typeid(Price));
+    const auto valid = quotes.mEncodes == encodes_count * 2 && quotes.mDecodes == encodes_count * 2 &&
+                       quotes.mEncodeBytes == bytes * encodes_count * 2 && quotes.mDecodeBytes == quotes.mEncodeBytes &&
+                       quotes.mEncodesOverReserve == 0 && prices.mEncodes == encodes_count * 2 * 8 &&
+                       prices.mDecodes == prices.mEncodes;
+
+    StreamableInstrumentation::Dump(cout);
+    cout << "The counters are " << (valid ? "valid" : "invalid") << endl;
+
+    return valid ? 0 : 1;
+}
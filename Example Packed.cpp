@@ -0,0 +1,84 @@
+#include "Streamable.hpp"
+
+using namespace hbann;
+
+#include <iostream>
+
+using namespace std;
+
+enum class Side : uint8_t
+{
+    Buy,
+    Sell
+};
+
+enum class State : uint8_t
+{
+    New,
+    Filled,
+    Canceled,
+    Rejected
+};
+
+ISTREAMABLE_PACKED_BITS(Side, 1)
+ISTREAMABLE_PACKED_BITS(State, 2)
+
+class Order : public IStreamable
+{
+    ISTREAMABLE_DEFINE_PACKED(Order, mIsLimit, mIsHidden, mSide, mState, mQuantity, mFills, mIsLast);
+
+  public:
+    Order() = default;
+
+    Order(const bool aIsLimit, const bool aIsHidden, const Side aSide, const State aState, const uint32_t aQuantity,
+          const vector<bool> &aFills, const bool aIsLast)
+        : mIsLimit(aIsLimit), mIsHidden(aIsHidden), mSide(aSide), mState(aState), mQuantity(aQuantity), mFills(aFills),
+          mIsLast(aIsLast)
+    {
+    }
+
+    bool operator==(const Order &aOrder) const
+    {
+        return mIsLimit == aOrder.mIsLimit && mIsHidden == aOrder.mIsHidden && mSide == aOrder.mSide &&
+               mState == aOrder.mState && mQuantity == aOrder.mQuantity && mFills == aOrder.mFills &&
+               mIsLast == aOrder.mIsLast;
+    }
+
+  private:
+    // the first 4 objects share a single byte
+    bool mIsLimit{};
+    bool mIsHidden{};
+    Side mSide{};
+    State mState{};
+    uint32_t mQuantity{};
+    vector<bool> mFills{}; // it's size followed by a bit per element
+    bool mIsLast{};
+};
+
+bool round_trip(Order &aOrder)
+{
+    auto stream = aOrder.ToStream();
+    const auto size = stream.size();
+
+    Order replica(move(stream));
+    const auto equal = replica == aOrder;
+
+    cout << "The replica of " << size << " bytes is " << (equal ? "equal" : "different") << endl;
+
+    return equal;
+}
+
+int main()
+{
+    vector<bool> fills(70); // not a multiple of 8 or 64 so the last bits are partial
+    for (size_t i = 0; i < fills.size(); i += 3)
+    {
+        fills[i] = true;
+    }
+
+    Order order(true, false, Side::Sell, State::Canceled, 1500, fills, true);
+    Order orderEmpty(false, true, Side::Buy, State::Rejected, 0, {}, false);
+
+    const auto equal = round_trip(order) & round_trip(orderEmpty);
+    return equal ? 0 : 1;
+}
@@ -0,0 +1,99 @@
+#include "Streamable.hpp"
+
+using namespace hbann;
+
+#include <iostream>
+
+using namespace std;
+
+class Player : public IStreamable
+{
+    ISTREAMABLE_DEFINE(Player, mName, mScore);
+
+  public:
+    Player() = default;
+
+    Player(const string &aName, const int aScore) : mName(aName), mScore(aScore)
+    {
+    }
+
+    int &GetScore()
+    {
+        return mScore;
+    }
+
+    bool operator==(const Player &aPlayer) const
+    {
+        return mName == aPlayer.mName && mScore == aPlayer.mScore;
+    }
+
+  private:
+    string mName{};
+    int mScore{};
+};
+
+class Match : public IStreamable
+{
+    ISTREAMABLE_DEFINE(Match, mRound, mMap, mPlayers);
+
+  public:
+    Match() = default;
+
+    Match(const uint32_t aRound, const string &aMap, const vector<Player> &aPlayers)
+        : mRound(aRound), mMap(aMap), mPlayers(aPlayers)
+    {
+    }
+
+    uint32_t &GetRound()
+    {
+        return mRound;
+    }
+
+    vector<Player> &GetPlayers()
+    {
+        return mPlayers;
+    }
+
+    bool operator==(const Match &aMatch) const
+    {
+        return mRound == aMatch.mRound && mMap == aMatch.mMap && mPlayers == aMatch.mPlayers;
+    }
+
+  private:
+    uint32_t mRound{};
+    string mMap{};
+    vector<Player> mPlayers{};
+};
+
+// the replica starts equal to the old snapshot and must be equal to the new one after the patch
+bool round_trip(const Match &aOld, const Match &aNew)
+{
+    auto patch = StreamablePatch::Create(aOld, aNew);
+    const auto size = patch.size();
+
+    auto replica = aOld;
+    const auto applied = StreamablePatch::Apply(replica, move(patch));
+    const auto equal = applied && replica == aNew;
+
+    cout << "The replica patched with " << size << " bytes is " << (equal ? "equal" : "different") << endl;
+
+    return equal;
+}
+
+int main()
+{
+    const Match match(1, "dust", {Player("ana", 10), Player("bob", 7), Player("cid", 3)});
+
+    // a patch of an unchanged object has just the empty bit mask
+    const auto equalUnchanged = round_trip(match, match);
+
+    auto matchNext = match;
+    matchNext.GetRound()++;
+    matchNext.GetPlayers()[1].GetScore() += 5;
+    matchNext.GetPlayers().pop_back();
+    matchNext.GetPlayers().emplace_back("dan", 0);
+    matchNext.GetPlayers().emplace_back("eve", 1);
+    const auto equalChanged = round_trip(match, matchNext);
+
+    return equalUnchanged && equalChanged ? 0 : 1;
+}
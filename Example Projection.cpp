@@ -0,0 +1,68 @@
+#include "Streamable.hpp"
+
+using namespace hbann;
+
+#include <iostream>
+
+using namespace std;
+
+class Article : public IStreamable
+{
+    ISTREAMABLE_DEFINE(Article, mID, mTitle, mBody, mTags, mViews);
+
+  public:
+    Article() = default;
+
+    Article(const uint64_t aID, const string &aTitle, const string &aBody, const vector<string> &aTags,
+            const uint32_t aViews)
+        : mID(aID), mTitle(aTitle), mBody(aBody), mTags(aTags), mViews(aViews)
+    {
+    }
+
+    const string &GetBody() const
+    {
+        return mBody;
+    }
+
+    // compares just the objects in the summary of an article
+    bool IsSummaryOf(const Article &aArticle) const
+    {
+        return mID == aArticle.mID && mTitle == aArticle.mTitle && mTags == aArticle.mTags && mBody.empty() &&
+               mViews == 0;
+    }
+
+  private:
+    uint64_t mID{};
+    string mTitle{};
+    string mBody{}; // big, so it's skipped by the summaries
+    vector<string> mTags{};
+    uint32_t mViews{}; // after the last selected object, so it's not touched
+};
+
+// the summary reads the id, the title and the tags and skips the body
+bool round_trip(const Article &aArticle)
+{
+    using ArticleAccessor = StreamableAccessor<Article>;
+
+    auto article = aArticle;
+    const auto &stream = article.ToStream();
+
+    Article summary;
+    ArticleAccessor::ReadObjects<0, 1, 3>(stream, summary);
+    const auto body = ArticleAccessor::ReadObject<2>(stream);
+    const auto equal = summary.IsSummaryOf(aArticle) && body == aArticle.GetBody();
+
+    cout << "The summary of the article with " << aArticle.GetBody().size() << " bytes of body is "
+         << (equal ? "equal" : "different") << endl;
+
+    return equal;
+}
+
+int main()
+{
+    const Article article(1, "Streams", string(16 * 1024, 'x'), {"c++", "serialization"}, 1000);
+    const Article articleEmpty(2, "", "", {}, 0);
+
+    const auto equal = round_trip(article) & round_trip(articleEmpty);
+    return equal ? 0 : 1;
+}
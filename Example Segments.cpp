@@ -0,0 +1,64 @@
+#include "Streamable.hpp"
+
+using namespace hbann;
+
+#include <iostream>
+
+using namespace std;
+
+class Frame : public IStreamable
+{
+    ISTREAMABLE_DEFINE(Frame, mID, mCodec, mPixels, mTimestamps);
+
+  public:
+    Frame() = default;
+
+    Frame(const uint32_t aID, const string &aCodec, const vector<uint8_t> &aPixels, const vector<uint64_t> &aTimestamps)
+        : mID(aID), mCodec(aCodec), mPixels(aPixels), mTimestamps(aTimestamps)
+    {
+    }
+
+    bool operator==(const Frame &aFrame) const
+    {
+        return mID == aFrame.mID && mCodec == aFrame.mCodec && mPixels == aFrame.mPixels &&
+               mTimestamps == aFrame.mTimestamps;
+    }
+
+  private:
+    uint32_t mID{};
+    string mCodec{};
+    vector<uint8_t> mPixels{};
+    vector<uint64_t> mTimestamps{};
+};
+
+// the segments would be passed to writev, here they are joined like the reader would receive them
+bool round_trip(Frame &aFrame)
+{
+    StreamableSegments segments(aFrame);
+
+    IStreamable::type_stream stream;
+    stream.reserve(segments.GetSize());
+    for (const auto &segment : segments.GetSegments())
+    {
+        const auto segmentPtr = static_cast<const uint8_t *>(segment.iov_base);
+        stream.insert(stream.end(), segmentPtr, segmentPtr + segment.iov_len);
+    }
+
+    const auto same = stream == aFrame.ToStream();
+    Frame replica(move(stream));
+    const auto equal = same && replica == aFrame;
+
+    cout << "The replica of " << segments.GetSize() << " bytes from " << segments.GetSegments().size()
+         << " segments is " << (equal ? "equal" : "different") << endl;
+
+    return equal;
+}
+
+int main()
+{
+    Frame frame(1, "raw", vector<uint8_t>(64 * 1024, 0x7f), {1700000000, 1700000040});
+    Frame frameEmpty(2, "", {}, {});
+
+    const auto equal = round_trip(frame) & round_trip(frameEmpty);
+    return equal ? 0 : 1;
+}
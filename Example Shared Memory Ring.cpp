@@ -0,0 +1,149 @@
+#include "StreamableRing.hpp"
+
+using namespace hbann;
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <sched.h>
+#include <sys/wait.h>
+#include <thread>
+
+using namespace std;
+using namespace chrono;
+
+constexpr auto ring_name = "/streamable_ring_example";
+constexpr size_t ring_capacity = 1 << 20;
+constexpr size_t messages_count = 200'000; // per producer, a multiple of the batches' size
+constexpr size_t messages_rate = 100'000;  // per producer per second, well below what the consumer can drain
+constexpr size_t read_batch = 64;          // the most records read at once so the consumer checks the ring often
+
+class Tick : public IStreamable
+{
+    ISTREAMABLE_DEFINE(Tick, mSentAt, mProducer, mSymbol, mPrices);
+
+  public:
+    Tick() = default;
+
+    Tick(const uint64_t aSentAt, const uint32_t aProducer, const string &aSymbol, const vector<double> &aPrices)
+        : mSentAt(aSentAt), mProducer(aProducer), mSymbol(aSymbol), mPrices(aPrices)
+    {
+    }
+
+  private:
+    uint64_t mSentAt{}; // the first object so the consumer can read it in place
+    uint32_t mProducer{};
+    string mSymbol{};
+    vector<double> mPrices{};
+};
+
+uint64_t now_ns()
+{
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+// pins the calling process to a core, the consumer gets the first core and every producer another one
+void pin_to_core(const uint32_t aCore)
+{
+    const auto cores = thread::hardware_concurrency();
+    if (cores < 2)
+    {
+        return; // everything shares the only core
+    }
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(aCore == 0 ? 0 : 1 + (aCore - 1) % (cores - 1), &set);
+    sched_setaffinity(0, sizeof(set), &set);
+}
+
+template <bool aMultipleProducers> void produce(const uint32_t aProducer, const size_t aBatchSize)
+{
+    pin_to_core(1 + aProducer);
+
+    // opened again because the producer is another process
+    StreamableRing<aMultipleProducers> ring(ring_name);
+
+    // the batches are sent at a fixed rate so the latency is the ring's and not the time spent queued in a full ring
+    const auto period = nanoseconds(seconds(1)) * aBatchSize / messages_rate;
+    auto next = steady_clock::now();
+
+    vector<Tick> batch(aBatchSize);
+    for (size_t i = 0; i < messages_count; i += aBatchSize, next += period)
+    {
+        while (steady_clock::now() < next)
+        {
+            this_thread::yield();
+        }
+
+        for (auto &tick : batch)
+        {
+            tick = Tick(now_ns(), aProducer, "EURUSD", {1.0841, 1.0843, 1.0842});
+        }
+
+        while (!ring.WriteAll(batch))
+        {
+            this_thread::yield(); // the ring is full
+        }
+    }
+}
+
+template <bool aMultipleProducers>
+void benchmark(const char *aName, const uint32_t aProducers, const size_t aBatchSize)
+{
+    StreamableRing<aMultipleProducers> ring(ring_name, ring_capacity);
+    if (!ring.IsOpen())
+    {
+        cerr << "Couldn't create the shared memory ring!" << endl;
+        return;
+    }
+
+    for (uint32_t producer = 0; producer < aProducers; producer++)
+    {
+        if (!fork())
+        {
+            produce<aMultipleProducers>(producer, aBatchSize);
+            _exit(0);
+        }
+    }
+
+    pin_to_core(0);
+
+    vector<uint64_t> latencies;
+    latencies.reserve(aProducers * messages_count);
+    while (latencies.size() < aProducers * messages_count)
+    {
+        // the timestamp is read directly from the record without deserializing the tick
+        const auto count = ring.ReadAll([&](const span<const uint8_t> aStream) {
+            latencies.push_back(now_ns() - StreamableAccessor<Tick>::ReadObject<0>(aStream));
+        }, read_batch);
+
+        if (!count)
+        {
+            this_thread::yield(); // the ring is empty
+        }
+    }
+
+    while (wait(nullptr) > 0)
+    {
+    }
+
+    sort(latencies.begin(), latencies.end());
+    const auto percentile = [&](const double aPercentile) {
+        return latencies[size_t(aPercentile / 100 * (latencies.size() - 1))];
+    };
+
+    cout << aName << ": " << latencies.size() << " messages, batches of " << aBatchSize << ", latency in ns: p50 "
+         << percentile(50) << ", p90 " << percentile(90) << ", p99 " << percentile(99) << ", p99.9 "
+         << percentile(99.9) << ", max " << latencies.back() << endl;
+}
+
+int main()
+{
+    benchmark<false>("SPSC", 1, 1);
+    benchmark<false>("SPSC", 1, 16);
+    benchmark<true>("MPSC", 2, 1);
+    benchmark<true>("MPSC", 2, 16);
+
+    return 0;
+}
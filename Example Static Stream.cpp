@@ -0,0 +1,58 @@
+#include "Streamable.hpp"
+
+using namespace hbann;
+
+#include <iostream>
+
+using namespace std;
+
+class Handshake : public IStreamable
+{
+    ISTREAMABLE_DEFINE(Handshake, mVersion, mName, mFeatures);
+
+  public:
+    constexpr ~Handshake() override
+    {
+    }
+
+    constexpr Handshake() = default;
+
+    constexpr Handshake(const uint16_t aVersion, const char *aName, const vector<uint32_t> &aFeatures)
+        : mVersion(aVersion), mName(aName), mFeatures(aFeatures)
+    {
+    }
+
+    constexpr bool operator==(const Handshake &aHandshake) const
+    {
+        return mVersion == aHandshake.mVersion && mName == aHandshake.mName && mFeatures == aHandshake.mFeatures;
+    }
+
+  private:
+    uint16_t mVersion{};
+    string mName{};
+    vector<uint32_t> mFeatures{};
+};
+
+constexpr auto handshake_factory = [] { return Handshake(3, "hello", {1, 2, 4, 8}); };
+constexpr auto handshake_static = IStreamable::ToStaticStream<handshake_factory>();
+
+// the array embedded in the binary must have the same bytes as the ToStream() of the same streamable
+static_assert([] {
+    auto handshake = handshake_factory();
+    const auto &stream = handshake.ToStream();
+    return equal(stream.begin(), stream.end(), handshake_static.begin(), handshake_static.end());
+}());
+
+int main()
+{
+    auto handshake = handshake_factory();
+    const auto stream = handshake.ToStream();
+    const auto same = equal(stream.begin(), stream.end(), handshake_static.begin(), handshake_static.end());
+
+    Handshake replica(IStreamable::type_stream(handshake_static.begin(), handshake_static.end()));
+
+    cout << "The static stream is " << (same ? "equal" : "different") << " to the runtime stream and the replica is "
+         << (replica == handshake_factory() ? "equal" : "different") << endl;
+
+    return same && replica == handshake_factory() ? 0 : 1;
+}
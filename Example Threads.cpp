@@ -0,0 +1,77 @@
+#include "Streamable.hpp"
+
+using namespace hbann;
+
+#include <iostream>
+#include <thread>
+
+using namespace std;
+
+class Inner : public IStreamable
+{
+    ISTREAMABLE_DEFINE(Inner, mValues);
+
+  public:
+    Inner() = default;
+
+    vector<int> &GetValues()
+    {
+        return mValues;
+    }
+
+    bool operator==(const Inner &aInner) const
+    {
+        return mValues == aInner.mValues;
+    }
+
+  private:
+    vector<int> mValues{};
+};
+
+class Outer : public IStreamable
+{
+    ISTREAMABLE_DEFINE(Outer, mInner, mTail);
+
+  public:
+    Outer() = default;
+
+    Outer(const Inner &aInner, const int aTail) : mInner(aInner), mTail(aTail)
+    {
+    }
+
+    Inner &GetInner()
+    {
+        return mInner;
+    }
+
+    bool operator==(const Outer &aOuter) const
+    {
+        return mInner == aOuter.mInner && mTail == aOuter.mTail;
+    }
+
+  private:
+    Inner mInner{};
+    int mTail{};
+};
+
+// every thread encodes with it's own encodes, so the size of the inner streamable found on the first thread must not
+// be reused on the second one after it changed
+int main()
+{
+    Outer outer(Inner(), 42);
+    outer.GetInner().GetValues() = {1, 2, 3};
+
+    thread([&] { outer.ToStream(); }).join();
+
+    outer.GetInner().GetValues().push_back(4);
+
+    Outer replica;
+    thread([&] {
+        auto stream = outer.ToStream();
+        replica = Outer(move(stream));
+    }).join();
+
+    cout << "The replica encoded on another thread is " << (replica == outer ? "equal" : "different") << endl;
+
+    return replica == outer ? 0 : 1;
+}
@@ -9,14 +9,53 @@
 
 #pragma region Includes
 
+#include <algorithm>   // std::min
+#include <array>
 #include <assert.h>
+#include <atomic>      // std::atomic
+#include <bit>         // std::bit_cast
+#include <compare>     // std::strong_ordering
+#include <concepts>    // std::equality_comparable
+#include <cstddef>     // std::max_align_t
+#include <cstdint>     // uintptr_t
+#include <cstring>     // std::memcpy
 #include <filesystem>  // std::filesystem::path
+#include <new>         // std::launder
 #include <span>
+#include <string>
+#include <string_view>
+#include <tuple>       // std::tie, std::tuple_cat
+#include <vector>
+
+#if __has_include(<sys/uio.h>)
+#include <climits>    // IOV_MAX
+#include <sys/uio.h>  // iovec
+#endif
+
+#ifdef ISTREAMABLE_INSTRUMENTATION
+#include <chrono>         // std::chrono::steady_clock
+#include <map>
+#include <mutex>          // std::mutex, std::scoped_lock
+#include <ostream>
+#include <typeindex>      // std::type_index
+#include <unordered_map>
+#include <utility>        // std::exchange
+#endif
 
 #pragma endregion
 
 #pragma region Defines
 
+// the instrumentation hooks are compiled only if ISTREAMABLE_INSTRUMENTATION is defined
+#ifdef ISTREAMABLE_INSTRUMENTATION
+#define ISTREAMABLE_INSTRUMENT(...) __VA_ARGS__
+#define ISTREAMABLE_INSTRUMENT_ENCODE() \
+  const hbann::StreamableInstrumentation::EncodeProbe probe(*this)
+#else
+#define ISTREAMABLE_INSTRUMENT(...)
+#define ISTREAMABLE_INSTRUMENT_ENCODE()
+#endif
+
 #define ISTREAMABLE_GET_OBJECTS_SIZE(...)               hbann::StreamableSizeFinder::FindObjectsSize(__VA_ARGS__)
 #define ISTREAMABLE_GET_OBJECTS_SIZE_DERIVED_START(...) ISTREAMABLE_GET_OBJECTS_SIZE(__VA_ARGS__)
 #define ISTREAMABLE_GET_OBJECTS_SIZE_DERIVED(base, ...) \
@@ -36,6 +75,23 @@
 #define ISTREAMABLE_DESERIALIZE_DERIVED(...)       IStreamable::ReadAll(__VA_ARGS__)
 #define ISTREAMABLE_DESERIALIZE_DERIVED_END(...)   ISTREAMABLE_DESERIALIZE(__VA_ARGS__)
 
+#define ISTREAMABLE_GET_OBJECTS_SIZE_PACKED(...) \
+  hbann::StreamableSizeFinder::FindPackedObjectsSize(__VA_ARGS__)
+#define ISTREAMABLE_SERIALIZE_PACKED(...)   IStreamable::InitAndWritePackedAll(__VA_ARGS__)
+#define ISTREAMABLE_DESERIALIZE_PACKED(...) IStreamable::ReadPackedAllAndClear(__VA_ARGS__)
+
+// declares the number of bits used by an enum in the packed mode, used in the global namespace
+#define ISTREAMABLE_PACKED_BITS(type, bits) \
+  template <>                               \
+  constexpr size_t hbann::packed_bits_v<type> = bits;
+
+#define ISTREAMABLE_GET_OBJECTS(...)               std::tie(__VA_ARGS__)
+#define ISTREAMABLE_GET_OBJECTS_DERIVED_START(...) ISTREAMABLE_GET_OBJECTS(__VA_ARGS__)
+#define ISTREAMABLE_GET_OBJECTS_DERIVED(base, ...) \
+  std::tuple_cat(base::GetObjects(), ISTREAMABLE_GET_OBJECTS(__VA_ARGS__))
+#define ISTREAMABLE_GET_OBJECTS_DERIVED_END(base, ...) \
+  ISTREAMABLE_GET_OBJECTS_DERIVED(base, __VA_ARGS__)
+
 #define ISTREAMABLE_DEFINE(className, ...)                  \
 public:                                                     \
   constexpr className(type_stream && aStream)               \
@@ -46,7 +102,20 @@ public:                                                     \
                                                             \
   constexpr type_stream && ToStream() override              \
   {                                                         \
-    return ISTREAMABLE_SERIALIZE(__VA_ARGS__);              \
+    ISTREAMABLE_INSTRUMENT_ENCODE();                        \
+    auto && stream = ISTREAMABLE_SERIALIZE(__VA_ARGS__);    \
+    assert(stream.size() == className::GetObjectsSize());   \
+    return move(stream);                                    \
+  }                                                         \
+                                                            \
+  constexpr auto GetObjects() noexcept                      \
+  {                                                         \
+    return ISTREAMABLE_GET_OBJECTS(__VA_ARGS__);            \
+  }                                                         \
+                                                            \
+  constexpr auto GetObjects() const noexcept                \
+  {                                                         \
+    return ISTREAMABLE_GET_OBJECTS(__VA_ARGS__);            \
   }                                                         \
                                                             \
 protected:                                                  \
@@ -55,67 +124,136 @@ protected:                                                  \
     return ISTREAMABLE_GET_OBJECTS_SIZE(__VA_ARGS__);       \
   }
 
-#define ISTREAMABLE_DEFINE_DERIVED_START(className, ...)            \
-public:                                                             \
-  constexpr className(type_stream && aStream)                       \
-    : IStreamable(move(aStream))                                    \
-  {                                                                 \
-    ISTREAMABLE_DESERIALIZE_DERIVED_START(__VA_ARGS__);             \
-  }                                                                 \
-                                                                    \
-  constexpr type_stream && ToStream() override                      \
-  {                                                                 \
-    return ISTREAMABLE_SERIALIZE_DERIVED_START(__VA_ARGS__);        \
-  }                                                                 \
-                                                                    \
-protected:                                                          \
-  constexpr size_t GetObjectsSize() const noexcept override         \
-  {                                                                 \
-    return ISTREAMABLE_GET_OBJECTS_SIZE_DERIVED_START(__VA_ARGS__); \
-  }
-
-#define ISTREAMABLE_DEFINE_DERIVED(className, baseClass, ...)            \
-public:                                                                  \
-  constexpr className(type_stream && aStream)                            \
-    : baseClass(move(aStream))                                           \
-  {                                                                      \
-    ISTREAMABLE_DESERIALIZE_DERIVED(__VA_ARGS__);                        \
-  }                                                                      \
-                                                                         \
-  constexpr type_stream && ToStream() override                           \
-  {                                                                      \
-    return ISTREAMABLE_SERIALIZE_DERIVED(baseClass, __VA_ARGS__);        \
-  }                                                                      \
-                                                                         \
-protected:                                                               \
-  constexpr size_t GetObjectsSize() const noexcept override              \
-  {                                                                      \
-    return ISTREAMABLE_GET_OBJECTS_SIZE_DERIVED(baseClass, __VA_ARGS__); \
-  }
-
-#define ISTREAMABLE_DEFINE_DERIVED_END(className, baseClass, ...)            \
-public:                                                                      \
-  constexpr className(type_stream && aStream)                                \
-    : baseClass(move(aStream))                                               \
-  {                                                                          \
-    ISTREAMABLE_DESERIALIZE_DERIVED_END(__VA_ARGS__);                        \
-  }                                                                          \
-                                                                             \
-  constexpr type_stream && ToStream() override                               \
-  {                                                                          \
-    return ISTREAMABLE_SERIALIZE_DERIVED_END(baseClass, __VA_ARGS__);        \
-  }                                                                          \
-                                                                             \
-protected:                                                                   \
-  constexpr size_t GetObjectsSize() const noexcept final override            \
-  {                                                                          \
-    return ISTREAMABLE_GET_OBJECTS_SIZE_DERIVED_END(baseClass, __VA_ARGS__); \
+#define ISTREAMABLE_DEFINE_DERIVED_START(className, ...)               \
+public:                                                                \
+  constexpr className(type_stream && aStream)                          \
+    : IStreamable(move(aStream))                                       \
+  {                                                                    \
+    ISTREAMABLE_DESERIALIZE_DERIVED_START(__VA_ARGS__);                \
+  }                                                                    \
+                                                                       \
+  constexpr type_stream && ToStream() override                         \
+  {                                                                    \
+    ISTREAMABLE_INSTRUMENT_ENCODE();                                   \
+    auto && stream = ISTREAMABLE_SERIALIZE_DERIVED_START(__VA_ARGS__); \
+    assert(stream.size() == className::GetObjectsSize());              \
+    return move(stream);                                               \
+  }                                                                    \
+                                                                       \
+  constexpr auto GetObjects() noexcept                                 \
+  {                                                                    \
+    return ISTREAMABLE_GET_OBJECTS_DERIVED_START(__VA_ARGS__);         \
+  }                                                                    \
+                                                                       \
+  constexpr auto GetObjects() const noexcept                           \
+  {                                                                    \
+    return ISTREAMABLE_GET_OBJECTS_DERIVED_START(__VA_ARGS__);         \
+  }                                                                    \
+                                                                       \
+protected:                                                             \
+  constexpr size_t GetObjectsSize() const noexcept override            \
+  {                                                                    \
+    return ISTREAMABLE_GET_OBJECTS_SIZE_DERIVED_START(__VA_ARGS__);    \
+  }
+
+#define ISTREAMABLE_DEFINE_DERIVED(className, baseClass, ...)               \
+public:                                                                     \
+  constexpr className(type_stream && aStream)                               \
+    : baseClass(move(aStream))                                              \
+  {                                                                         \
+    ISTREAMABLE_DESERIALIZE_DERIVED(__VA_ARGS__);                           \
+  }                                                                         \
+                                                                            \
+  constexpr type_stream && ToStream() override                              \
+  {                                                                         \
+    ISTREAMABLE_INSTRUMENT_ENCODE();                                        \
+    auto && stream = ISTREAMABLE_SERIALIZE_DERIVED(baseClass, __VA_ARGS__); \
+    assert(stream.size() == className::GetObjectsSize());                   \
+    return move(stream);                                                    \
+  }                                                                         \
+                                                                            \
+  constexpr auto GetObjects() noexcept                                      \
+  {                                                                         \
+    return ISTREAMABLE_GET_OBJECTS_DERIVED(baseClass, __VA_ARGS__);         \
+  }                                                                         \
+                                                                            \
+  constexpr auto GetObjects() const noexcept                                \
+  {                                                                         \
+    return ISTREAMABLE_GET_OBJECTS_DERIVED(baseClass, __VA_ARGS__);         \
+  }                                                                         \
+                                                                            \
+protected:                                                                  \
+  constexpr size_t GetObjectsSize() const noexcept override                 \
+  {                                                                         \
+    return ISTREAMABLE_GET_OBJECTS_SIZE_DERIVED(baseClass, __VA_ARGS__);    \
+  }
+
+#define ISTREAMABLE_DEFINE_DERIVED_END(className, baseClass, ...)               \
+public:                                                                         \
+  constexpr className(type_stream && aStream)                                   \
+    : baseClass(move(aStream))                                                  \
+  {                                                                             \
+    ISTREAMABLE_DESERIALIZE_DERIVED_END(__VA_ARGS__);                           \
+  }                                                                             \
+                                                                                \
+  constexpr type_stream && ToStream() override                                  \
+  {                                                                             \
+    ISTREAMABLE_INSTRUMENT_ENCODE();                                            \
+    auto && stream = ISTREAMABLE_SERIALIZE_DERIVED_END(baseClass, __VA_ARGS__); \
+    assert(stream.size() == className::GetObjectsSize());                       \
+    return move(stream);                                                        \
+  }                                                                             \
+                                                                                \
+  constexpr auto GetObjects() noexcept                                          \
+  {                                                                             \
+    return ISTREAMABLE_GET_OBJECTS_DERIVED_END(baseClass, __VA_ARGS__);         \
+  }                                                                             \
+                                                                                \
+  constexpr auto GetObjects() const noexcept                                    \
+  {                                                                             \
+    return ISTREAMABLE_GET_OBJECTS_DERIVED_END(baseClass, __VA_ARGS__);         \
+  }                                                                             \
+                                                                                \
+protected:                                                                      \
+  constexpr size_t GetObjectsSize() const noexcept final override               \
+  {                                                                             \
+    return ISTREAMABLE_GET_OBJECTS_SIZE_DERIVED_END(baseClass, __VA_ARGS__);    \
+  }
+
+// like ISTREAMABLE_DEFINE but consecutive bools and enums declared with ISTREAMABLE_PACKED_BITS
+// are packed in bit fields and vector<bool>s are packed in bits too
+// note: it doesn't define GetObjects because the objects are not streamed the usual way
+#define ISTREAMABLE_DEFINE_PACKED(className, ...)               \
+public:                                                         \
+  constexpr className(type_stream && aStream)                   \
+    : IStreamable(move(aStream))                                \
+  {                                                             \
+    ISTREAMABLE_DESERIALIZE_PACKED(__VA_ARGS__);                \
+  }                                                             \
+                                                                \
+  constexpr type_stream && ToStream() override                  \
+  {                                                             \
+    ISTREAMABLE_INSTRUMENT_ENCODE();                            \
+    auto && stream = ISTREAMABLE_SERIALIZE_PACKED(__VA_ARGS__); \
+    assert(stream.size() == className::GetObjectsSize());       \
+    return move(stream);                                        \
+  }                                                             \
+                                                                \
+protected:                                                      \
+  constexpr size_t GetObjectsSize() const noexcept override     \
+  {                                                             \
+    return ISTREAMABLE_GET_OBJECTS_SIZE_PACKED(__VA_ARGS__);    \
   }
 
 #pragma endregion
 
 namespace hbann
 {
+template <std::ranges::range Range>
+class ColumnarRange;
+template <std::ranges::range Range>
+class DeltaRange;
+
 #pragma region Type Traits Impl
 
 namespace impl
@@ -134,6 +272,46 @@ struct has_method_reserve<Container, std::void_t<decltype(std::declval<Container
   : std::true_type
 {
 };
+
+template <typename Type, typename = void>
+struct has_method_get_objects : std::false_type
+{
+};
+template <typename Type>
+struct has_method_get_objects<Type, std::void_t<decltype(std::declval<Type &>().GetObjects())>>
+  : std::true_type
+{
+};
+
+template <typename Type>
+constexpr auto is_delta_range_v = false;
+template <typename Range>
+constexpr auto is_delta_range_v<DeltaRange<Range>> = true;
+
+template <typename Type>
+constexpr auto is_bool_vector_v = false;
+template <typename... Types>
+constexpr auto is_bool_vector_v<std::vector<bool, Types...>> = true;
+
+template <typename Type>
+constexpr auto is_columnar_range_v = false;
+template <typename Range>
+constexpr auto is_columnar_range_v<ColumnarRange<Range>> = true;
+
+template <typename Type>
+constexpr auto has_mutable_elements_v = false;
+template <std::ranges::range Range>
+constexpr auto has_mutable_elements_v<Range> =
+  !std::is_const_v<std::remove_reference_t<std::ranges::range_reference_t<Range>>>;
+
+template <typename Type>
+constexpr auto is_resizable_range_v = false;
+template <std::ranges::range Range>
+constexpr auto is_resizable_range_v<Range> =
+  requires(Range & aRange, std::ranges::range_value_t<Range> && aValue) {
+    aRange.erase(std::ranges::begin(aRange), std::ranges::end(aRange));
+    aRange.insert(std::ranges::cend(aRange), std::move(aValue));
+  };
 }  // namespace impl
 
 #pragma endregion
@@ -147,17 +325,44 @@ template <typename Type>
 constexpr auto is_basic_string_v = impl::is_basic_string_v<std::remove_cvref_t<Type>>;
 template <typename Type>
 constexpr auto has_method_reserve_v = impl::has_method_reserve<Type>::value;
+template <typename Type>
+constexpr auto has_method_get_objects_v = impl::has_method_get_objects<Type>::value;
+template <typename Type>
+constexpr auto is_columnar_range_v = impl::is_columnar_range_v<std::remove_cvref_t<Type>>;
+template <typename Type>
+constexpr auto is_delta_range_v = impl::is_delta_range_v<std::remove_cvref_t<Type>>;
+template <typename Type>
+constexpr auto is_bool_vector_v = impl::is_bool_vector_v<std::remove_cvref_t<Type>>;
+
+// the number of bits used by the object in the packed mode, 0 means it's not packed
+// specialize it with ISTREAMABLE_PACKED_BITS for enums whose values fit in fewer bits
+template <typename Type>
+constexpr size_t packed_bits_v = 0;
+template <>
+constexpr size_t packed_bits_v<bool> = 1;
 
 class IStreamable;
 
 // useful type traits
 template <typename Type>
+constexpr auto is_known_size_v =  // objects that are streamed exactly as they are in memory
+  std::is_standard_layout_v<Type> && std::is_trivially_copyable_v<Type>;
+template <typename Type>
 constexpr auto is_accepted_no_range_v =
   !std::is_pointer_v<Type> &&
   (is_basic_string_v<Type> || std::is_same_v<std::remove_cvref_t<Type>, std::filesystem::path> ||
-   std::is_standard_layout_v<Type> || std::is_base_of_v<IStreamable, Type>);
+   is_known_size_v<Type> || std::is_base_of_v<IStreamable, Type> ||
+   is_columnar_range_v<Type> || is_delta_range_v<Type>);
 template <typename Type>
 constexpr auto is_accepted_v = std::ranges::range<Type> || is_accepted_no_range_v<Type>;
+template <typename Type>
+constexpr auto is_patchable_range_v =  // ranges whose elements can be patched in place
+  std::ranges::forward_range<Type> && !is_basic_string_v<Type> && !is_bool_vector_v<Type> &&
+  !is_known_size_v<Type> && !std::is_same_v<std::remove_cvref_t<Type>, std::filesystem::path> &&
+  impl::has_mutable_elements_v<Type>;
+template <typename Type>
+constexpr auto is_resizable_range_v =  // ranges whose elements can be erased and appended
+  impl::is_resizable_range_v<std::remove_cvref_t<Type>>;
 
 #pragma endregion
 
@@ -182,7 +387,7 @@ public:
   static [[nodiscard]] constexpr decltype(auto) FindObjectsSize(const Type & aObject,
                                                                 const Types &... aObjects) noexcept
   {
-    static_assert(is_accepted_v<Type>, "The object's type is not accepted!");
+    AssertAccepted<Type>();
 
     if constexpr (std::ranges::range<Type> && !is_accepted_no_range_v<Type>)
     {
@@ -212,22 +417,34 @@ public:
     }
     else if constexpr (std::is_same_v<std::remove_cvref_t<Type>, std::filesystem::path>)
     {
-      const auto sizeInBytesOfPath = aObject.wstring().size() * sizeof(Type::value_type);
+      // paths are streamed as wide strings on every platform
+      const auto sizeInBytesOfPath = aObject.wstring().size() * sizeof(std::wstring::value_type);
       // not a known size object so add the size in bytes of it's leading size in bytes
       return sizeof(type_size_sub_stream) + sizeInBytesOfPath;
     }
-    else if constexpr (std::is_standard_layout_v<Type>)
+    else if constexpr (is_known_size_v<Type>)
     {
       return sizeof(Type);
     }
     else if constexpr (std::is_base_of_v<IStreamable, Type>)
     {
-      return static_cast<const IStreamable *>(&aObject)->GetObjectsSize();
+      const auto sizeInBytesOfStreamable =
+        static_cast<const IStreamable *>(&aObject)->FindObjectsSize();
+      // not a known size object so add the size in bytes of it's leading size in bytes
+      return sizeof(type_size_sub_stream) + sizeInBytesOfStreamable;
+    }
+    else if constexpr (is_columnar_range_v<Type>)
+    {
+      return FindColumnsSize(aObject);
+    }
+    else if constexpr (is_delta_range_v<Type>)
+    {
+      return Type::FindSize(aObject);
     }
     else
     {
       static_assert(std::ranges::range<Type>, "Use FindRangeSize for ranges!");
-      static_assert(always_false<Type>, "The object's type is not accepted!");
+      AssertAccepted<Type, false>();
     }
   }
 
@@ -256,21 +473,29 @@ public:
    * @return the required size in bytes to store the range in the stream
    */
   template <typename Type>
-  static [[nodiscard]] constexpr decltype(auto) FindRangeSize(const Type & aObject) noexcept
+  static [[nodiscard]] constexpr size_t FindRangeSize(const Type & aObject) noexcept
   {
     if constexpr (FindRangeLayersCount<Type>())
     {
-      const auto size = std::ranges::size(aObject);
-      if (size)
+      using type_value = std::ranges::range_value_t<Type>;
+
+      // not a known size object so add the size in bytes of it's leading size in bytes
+      // (even if there are no elements in the nested stream we still need to specify that)
+      size_t size = sizeof(type_size_sub_stream);
+      if constexpr (is_known_size_v<type_value>)
       {
-        // not a known size object so add the size in bytes of it's leading size in bytes
-        return sizeof(type_size_sub_stream) + size * FindRangeSize(*std::ranges::cbegin(aObject));
+        // every element has the same size so we don't need to visit them
+        size += std::ranges::size(aObject) * sizeof(type_value);
       }
       else
       {
-        // if there are no elements in the nested stream we still need to specify that
-        return sizeof(type_size_sub_stream);
+        for (const auto & object : aObject)
+        {
+          size += FindRangeSize(object);
+        }
       }
+
+      return size;
     }
     else
     {
@@ -279,500 +504,3658 @@ public:
   }
 
   /**
-   * @brief Used by FindObjectsSize(...) when there nothing to unfold
-   * @return 0
-   */
-  static constexpr size_t FindObjectsSize() noexcept { return 0; }
-};
-
-/**
- * @brief Fast and easy to use single-header parser with a simple format for C++20
- */
-class IStreamable
-{
-  friend class StreamableSizeFinder;
-
-  /*
-      Format: [4 bytes +] any data + repeat...
-
-          [4 bytes +] -> optional bytes that are available if *any data* is not a known size object
-             any data -> any continuous stream of bytes
-
-
-      ex.:
-              We have a *type* that is a uint8_t and an *ID* that is string, the *mBytes* will
-     contain:
-                  - the *type* as a stream of bytes because it's a known size object
-                  - the size in bytes of *ID* as bytes because it's not a known size object followed
-     by the *ID* as a stream of bytes
-
-
-              uint8_t type = 24;
-              string ID = "ea025860-02bd-47cb-b053-b82ca250e4ba";
-
-             1 byte   +  4 bytes  +     36 bytes
-              0x18    +   0x24    +   *ID* as bytes
-  */
-  std::vector<uint8_t> mStream{};
-
-public:
-  using type_size_sub_stream = StreamableSizeFinder::type_size_sub_stream;
-  using type_stream          = decltype(mStream);
-  using type_stream_value    = type_stream::value_type;
-
-  /**
-   * @brief Default constructor used with ToStream
-   */
-  constexpr IStreamable() noexcept = default;
-
-  /**
-   * @brief Converts the stream to an object
-   * @note Flow with simple classes: ISTREAMABLE_SERIALIZE(...) in class
-   * @note Flow with base/derived classes:
-   * base class will use ISTREAMABLE_DESERIALIZE_DERIVED_START(...)
-   * middle derived classes will use ISTREAMABLE_DESERIALIZE_DERIVED(...)
-   * last derived class will use ISTREAMABLE_DESERIALIZE_DERIVED_END(...)
-   * @param aStream the object as a rvalue stream
-   */
-  constexpr explicit IStreamable(type_stream && aStream) noexcept { Assign(move(aStream)); }
-
-  /**
-   * @brief Uhmm, just a destructor..
-   */
-  constexpr virtual ~IStreamable() noexcept = default;
-
-  /**
-   * @brief Converts the object to a stream
-   * @note Flow with simple classes: ISTREAMABLE_DESERIALIZE(...) in class
-   * @note Flow with base/derived classes:
-   * base class will use ISTREAMABLE_SERIALIZE_DERIVED_START(...)
-   * middle derived classes will use ISTREAMABLE_SERIALIZE_DERIVED(...)
-   * last derived class will use ISTREAMABLE_SERIALIZE_DERIVED_END(...)
-   * @return the object as a rvalue stream
-   */
-  virtual [[nodiscard]] type_stream && ToStream() = 0;
-
-  // C++20 magic
-  auto operator<=>(const IStreamable &) const = default;
-
-protected:
-  /**
-   * @brief Gets the required size to store the object
+   * @brief Calculates the required size in bytes to store the objects in the packed mode
+   * @note The bits of the packed objects are known at compile time
+   * @tparam ...Types the objects' types
+   * @param ...aObjects the objects
+   * @return the required size in bytes to store the objects in the packed mode
    */
-  virtual constexpr size_t GetObjectsSize() const noexcept = 0;
-
-#pragma region XWriteAll
+  template <typename... Types>
+  static [[nodiscard]] constexpr size_t FindPackedObjectsSize(const Types &... aObjects) noexcept
+  {
+    constexpr auto sizeOfPackedObjects = FindPackedBitsSize<std::remove_cvref_t<Types>...>();
+    return sizeOfPackedObjects + (FindUnpackedObjectSize(aObjects) + ... + 0);
+  }
 
   /**
-   * @brief Initializes the stream and writes all the objects to it
-   * @return the rvalue stream
+   * @brief Calculates the size in bytes of the bit fields of the packed objects
+   * @note Every run of consecutive packed objects is rounded up to a byte
+   * @tparam ...Types the objects' types
+   * @return the size in bytes of the bit fields
    */
   template <typename... Types>
-  [[nodiscard]] constexpr decltype(auto) InitAndWriteAll(Types &... aObjects)
+  static [[nodiscard]] consteval size_t FindPackedBitsSize() noexcept
   {
-    Init();
-
-    if constexpr (sizeof...(aObjects))
+    size_t size{};
+    size_t bits{};
+    for (const auto bitsOfObject : { size_t{}, packed_bits_v<Types>... })
     {
-      WriteAll(aObjects...);
+      if (bitsOfObject)
+      {
+        bits += bitsOfObject;
+      }
+      else
+      {
+        size += (bits + 7) / 8;
+        bits = {};
+      }
     }
 
-    return Release();
+    return size + (bits + 7) / 8;
   }
 
   /**
-   * @brief Assigns the stream and writes all the objects to it
-   * @tparam ...Types the rest of object's types
-   * @param aStream the rvalue stream
-   * @param ...aObjects the rest of object
-   * @return the rvalue stream
+   * @brief Calculates the required size in bytes to store an object that is not a bit field in
+   * the packed mode
+   * @tparam Type the object's type
+   * @param aObject the object
+   * @return the required size in bytes to store the object or 0 for bit fields
    */
-  template <typename... Types>
-  [[nodiscard]] constexpr decltype(auto) AssignAndWriteAll(type_stream && aStream,
-                                                           const Types &... aObjects)
+  template <typename Type>
+  static [[nodiscard]] constexpr size_t FindUnpackedObjectSize(const Type & aObject) noexcept
   {
-    Assign(move(aStream), false);
-
-    if constexpr (sizeof...(aObjects))
+    if constexpr (packed_bits_v<Type>)
     {
-      WriteAll(aObjects...);
+      return 0;
+    }
+    else if constexpr (is_bool_vector_v<Type>)
+    {
+      return sizeof(type_size_sub_stream) + (aObject.size() + 7) / 8;
+    }
+    else
+    {
+      return FindObjectsSize(aObject);
     }
-
-    return Release();
   }
 
-#pragma endregion
-
-#pragma region ReadAllX
-
   /**
-   * @brief Reads all the object from the stream
-   * @tparam Type the current object's type
-   * @tparam ...Types the rest of object's types
-   * @param aObject the current object
-   * @param ...aObjects the rest of object
+   * @brief Calculates the required size in bytes to store the columnar range in the stream
+   * @tparam Range the columnar range's type
+   * @param aRange the columnar range
+   * @return the required size in bytes to store the columnar range in the stream
    */
-  template <typename Type, typename... Types>
-  constexpr void ReadAll(Type & aObject, Types &... aObjects)
+  template <typename Range>
+  static [[nodiscard]] constexpr size_t FindColumnsSize(const Range & aRange) noexcept
   {
-    aObject = Read<Type>();
+    using type_columns = typename Range::type_columns;
 
-    if constexpr (sizeof...(aObjects))
+    // the rows count followed by every column's size in bytes and the column itself
+    return sizeof(type_size_sub_stream) +
+           [&]<size_t... aIndexes>(std::index_sequence<aIndexes...>)
     {
-      ReadAll(aObjects...);
-    }
+      return (FindColumnSize<aIndexes>(aRange) + ... + 0);
+    }(std::make_index_sequence<std::tuple_size_v<type_columns>>());
   }
 
   /**
-   * @brief Reads the objects from the stream and clears it
-   * @tparam ...Types the objects's type
-   * @param ...aObjects the object be read
+   * @brief Calculates the required size in bytes to store a column of a columnar range
+   * @tparam aIndex the column's index in the element's objects
+   * @tparam Range the columnar range's type
+   * @param aRange the columnar range
+   * @return the required size in bytes to store the column in the stream
    */
-  template <typename... Types>
-  constexpr void ReadAllAndClear(Types &... aObjects) noexcept
+  template <size_t aIndex, typename Range>
+  static [[nodiscard]] constexpr size_t FindColumnSize(const Range & aRange) noexcept
   {
-    if constexpr (sizeof...(aObjects))
+    using type_column = typename Range::template type_column<aIndex>;
+
+    size_t size = sizeof(type_size_sub_stream);
+    if constexpr (is_known_size_v<type_column>)
     {
-      ReadAll(aObjects...);
+      size += std::ranges::size(aRange) * sizeof(type_column);
+    }
+    else
+    {
+      for (const auto & row : aRange)
+      {
+        size += FindObjectsSize(std::get<aIndex>(row.GetObjects()));
+      }
     }
 
-    Clear();
+    return size;
   }
 
-#pragma endregion
+  /**
+   * @brief Used by FindObjectsSize(...) when there nothing to unfold
+   * @return 0
+   */
+  static constexpr size_t FindObjectsSize() noexcept { return 0; }
 
-private:
-  size_t mIndex{};
+#pragma region Helpers
 
   /**
-   * @brief Allocates memory for the fixed size stream
-   * @note Finds the size automatically for derived classes
+   * @brief Reads a size of a stream inside the stream
+   * @param aStream the stream
+   * @param aIndex the size's position in the stream
+   * @return the size
    */
-  constexpr void Init()
+  static [[nodiscard]] type_size_sub_stream ReadSize(std::span<const uint8_t> aStream,
+                                                     const size_t             aIndex) noexcept
   {
-    mStream = type_stream();
-    mStream.reserve(GetObjectsSize());
-    mIndex = {};
+    type_size_sub_stream size{};
+    std::memcpy(&size, aStream.data() + aIndex, sizeof(size));
+    return size;
   }
 
   /**
-   * @brief Assigns the stream
-   * @param aStream the rvalue stream
-   * @param aReset should reset the stream's index
+   * @brief Writes a size of a stream inside the stream over the bytes reserved for it
+   * @param aStream the stream
+   * @param aIndex the size's position in the stream
+   * @param aSize the size
    */
-  constexpr void Assign(type_stream && aStream, const bool aReset = true) noexcept
+  static void WriteSize(std::span<uint8_t> aStream, const size_t aIndex,
+                        const size_t aSize) noexcept
   {
-    if (aReset)
-    {
-      mIndex = {};
-    }
-
-    mStream = move(aStream);
+    const auto size = type_size_sub_stream(aSize);
+    std::memcpy(aStream.data() + aIndex, &size, sizeof(size));
   }
 
   /**
-   * @brief Releases the stream
-   * @return the rvalue stream
-   */
-  [[nodiscard]] constexpr decltype(auto) Release() noexcept { return move(mStream); }
-
-  /**
-   * @brief Clears the stream and it's index
+   * @brief Appends a size of a stream inside the stream
+   * @param aStream the stream
+   * @param aSize the size
    */
-  constexpr void Clear() noexcept
+  static void AppendSize(std::vector<uint8_t> & aStream, const size_t aSize)
   {
-    mStream.clear();
-    mIndex = {};
+    const auto size    = type_size_sub_stream(aSize);
+    const auto sizePtr = reinterpret_cast<const uint8_t *>(&size);
+    aStream.insert(aStream.end(), sizePtr, sizePtr + sizeof(size));
   }
 
-#pragma region WriteX
-
   /**
-   * @brief Writes the size as bytes to the stream
-   * @param aSize the size
+   * @brief Stops the compilation if the object's type is not accepted
+   * @tparam Type the object's type
+   * @tparam aAccepted false for the branches that no accepted type should reach
    */
-  void WriteSize(const type_size_sub_stream aSize)
+  template <typename Type, bool aAccepted = is_accepted_v<Type>>
+  static constexpr void AssertAccepted() noexcept
   {
-    // write the stream's size as bytes
-    const auto sizePtr = reinterpret_cast<const type_stream_value *>(&aSize);
-    mStream.insert(mStream.end(), sizePtr, sizePtr + sizeof(type_size_sub_stream));
-    mIndex += sizeof(type_size_sub_stream);
+    static_assert(aAccepted, "The object's type is not accepted!");
   }
 
   /**
-   * @brief Writes all the object in the stream
-   * @tparam Type the current object's type
-   * @tparam ...Types the rest of object's types
-   * @param aObject the current object
-   * @param ...aObjects the rest of object
+   * @brief Stops the compilation if the object doesn't implement IStreamable
+   * @tparam Type the object's type
+   * @tparam aDefined true if the object must be defined with the ISTREAMABLE_DEFINE_X macros too
    */
-  template <typename Type, typename... Types>
-  constexpr void WriteAll(Type & aObject, Types &... aObjects)
+  template <typename Type, bool aDefined = true>
+  static constexpr void AssertStreamable() noexcept
   {
-    Write(aObject);
-
+    if constexpr (aDefined)
+    {
+      static_assert(std::is_base_of_v<IStreamable, Type> && has_method_get_objects_v<Type>,
+                    "The object must implement IStreamable with the ISTREAMABLE_DEFINE_X macros!");
+    }
+    else
+    {
+      static_assert(std::is_base_of_v<IStreamable, Type>, "The object must implement IStreamable!");
+    }
+  }
+
+#pragma endregion
+};
+
+/**
+ * @brief A range that is streamed column by column instead of element by element
+ * @note The elements must be defined with one of the ISTREAMABLE_DEFINE_X macros
+ * @note Format: rows count + (column's size in bytes + column) for every member of the element,
+ * where a known size column is a contiguous array of the member and any other column contains
+ * the member of every element one after another like a normal range would
+ * @tparam Range the underlying range's type
+ */
+template <std::ranges::range Range>
+class ColumnarRange : public Range
+{
+public:
+  using type_range  = Range;
+  using type_row    = typename Range::value_type;
+  using type_stream = std::span<const uint8_t>;
+  using type_size   = StreamableSizeFinder::type_size_sub_stream;
+  using type_columns =
+    std::remove_cvref_t<decltype(std::declval<const type_row &>().GetObjects())>;
+
+  template <size_t aIndex>
+  using type_column = std::remove_cvref_t<std::tuple_element_t<aIndex, type_columns>>;
+
+  using Range::Range;
+
+  constexpr ColumnarRange() = default;
+
+  constexpr ColumnarRange(const Range & aRange)
+    : Range(aRange)
+  {
+  }
+
+  constexpr ColumnarRange(Range && aRange) noexcept
+    : Range(std::move(aRange))
+  {
+  }
+
+  /**
+   * @brief Finds a column inside a stream that starts with a columnar range
+   * @tparam aIndex the column's index in the element's objects
+   * @param aStream the stream that starts with the columnar range
+   * @return the column's bytes without it's leading size in bytes
+   */
+  template <size_t aIndex>
+  static [[nodiscard]] type_stream FindColumn(type_stream aStream) noexcept
+  {
+    static_assert(aIndex < std::tuple_size_v<type_columns>, "The column doesn't exist!");
+
+    auto index = sizeof(type_size);
+    for (size_t column = 0; column < aIndex; column++)
+    {
+      index += sizeof(type_size) + StreamableSizeFinder::ReadSize(aStream, index);
+    }
+
+    return aStream.subspan(index + sizeof(type_size),
+                           StreamableSizeFinder::ReadSize(aStream, index));
+  }
+
+  /**
+   * @brief Reads just a column from a stream that starts with a columnar range
+   * @note The member must be a known size object so the column is copied at once
+   * @tparam aIndex the column's index in the element's objects
+   * @param aStream the stream that starts with the columnar range
+   * @return the column's values
+   */
+  template <size_t aIndex>
+  static [[nodiscard]] decltype(auto) ReadColumn(type_stream aStream)
+  {
+    static_assert(is_known_size_v<type_column<aIndex>>,
+                  "Only known size columns can be read directly!");
+
+    const auto                            column = FindColumn<aIndex>(aStream);
+    std::vector<type_column<aIndex>> values(column.size_bytes() / sizeof(type_column<aIndex>));
+    if (!values.empty())  // the data of an empty vector may be null
+    {
+      std::memcpy(values.data(), column.data(), column.size_bytes());
+    }
+
+    return values;
+  }
+};
+
+/**
+ * @brief A range of integers that is streamed as the zigzag encoded deltas between it's elements
+ * bit packed in blocks, so sorted IDs, timestamps etc... need just a few bits per element
+ * @note Format: elements count + size in bytes of the first element and the blocks + the first
+ * element + blocks, where a block has the bits count of it's widest delta followed by up to
+ * kBlockSize deltas packed with that many bits
+ * @note The first element is written as it is and the deltas start from it, so a big first value
+ * (ex.: a timestamp in nanoseconds) doesn't widen the deltas of the first block
+ * @note Decoding unpacks a whole block at once with shifts known at compile time and then does a
+ * prefix sum over it, both loops are scalar
+ * @tparam Range the underlying range's type
+ */
+template <std::ranges::range Range>
+class DeltaRange : public Range
+{
+public:
+  using type_range  = Range;
+  using type_value  = std::ranges::range_value_t<Range>;
+  using type_stream = std::vector<uint8_t>;
+  using type_size   = StreamableSizeFinder::type_size_sub_stream;
+
+  static_assert(std::is_integral_v<type_value> && sizeof(type_value) <= sizeof(uint64_t),
+                "Only ranges of integers can be delta encoded!");
+
+  static constexpr size_t kBlockSize = 128;  // the number of deltas in a block
+
+  using Range::Range;
+
+  constexpr DeltaRange() = default;
+
+  constexpr DeltaRange(const Range & aRange)
+    : Range(aRange)
+  {
+  }
+
+  constexpr DeltaRange(Range && aRange) noexcept
+    : Range(std::move(aRange))
+  {
+  }
+
+  /**
+   * @brief Calculates the required size in bytes to store the range in the stream
+   * @param aRange the range
+   * @return the required size in bytes to store the range in the stream
+   */
+  static [[nodiscard]] size_t FindSize(const Range & aRange) noexcept
+  {
+    size_t size = sizeof(type_size) * 2 + (std::ranges::empty(aRange) ? 0 : sizeof(uint64_t));
+    ForEachBlock(aRange,
+                 [&](const uint64_t *, const size_t aCount, const size_t aBits)
+                 {
+                   size += 1 + (aCount * aBits + 7) / 8;
+                 });
+
+    return size;
+  }
+
+  /**
+   * @brief Writes the range to the stream
+   * @param aRange the range
+   * @param aStream the stream to append the range to
+   * @return the number of bytes written
+   */
+  static size_t Encode(const Range & aRange, type_stream & aStream)
+  {
+    const auto start = aStream.size();
+    StreamableSizeFinder::AppendSize(aStream, std::ranges::size(aRange));
+    StreamableSizeFinder::AppendSize(aStream, 0);  // patched once the blocks are written
+
+    if (!std::ranges::empty(aRange))
+    {
+      const auto first    = FindFirst(aRange);
+      const auto firstPtr = reinterpret_cast<const uint8_t *>(&first);
+      aStream.insert(aStream.end(), firstPtr, firstPtr + sizeof(first));
+    }
+
+    ForEachBlock(aRange,
+                 [&](const uint64_t * aDeltas, const size_t aCount, const size_t aBits)
+                 {
+                   aStream.push_back(uint8_t(aBits));
+                   Pack(aDeltas, aCount, aBits, aStream);
+                 });
+
+    StreamableSizeFinder::WriteSize(aStream, start + sizeof(type_size),
+                                    aStream.size() - start - sizeof(type_size) * 2);
+
+    return aStream.size() - start;
+  }
+
+  /**
+   * @brief Reads the range from the stream
+   * @param aStream the stream that starts with the range
+   * @param aRange the range to read the elements to
+   * @return the number of bytes read
+   */
+  static size_t Decode(std::span<const uint8_t> aStream, Range & aRange)
+  {
+    const auto count      = StreamableSizeFinder::ReadSize(aStream, 0);
+    const auto blocksSize = StreamableSizeFinder::ReadSize(aStream, sizeof(type_size));
+    const auto blocks     = aStream.subspan(sizeof(type_size) * 2, blocksSize);
+
+    // contiguous ranges are resized so the blocks are decoded directly in them
+    constexpr auto isDirect = std::ranges::contiguous_range<Range> &&
+                              requires(Range & aRangeDirect) { aRangeDirect.resize(0); };
+
+    if constexpr (isDirect)
+    {
+      aRange.resize(count);
+    }
+    else
+    {
+      aRange.clear();
+      if constexpr (has_method_reserve_v<Range>)
+      {
+        aRange.reserve(count);
+      }
+    }
+
+    uint64_t previous{};
+    uint64_t deltas[kBlockSize]{};
+    size_t   index{};
+    if (count)
+    {
+      std::memcpy(&previous, blocks.data(), sizeof(previous));
+      index += sizeof(previous);
+    }
+
+    for (size_t i = 0; i < count; i += kBlockSize)
+    {
+      const auto blockCount = std::min<size_t>(kBlockSize, count - i);
+      const auto bits       = size_t(blocks[index++]);
+
+      Unpack(blocks.subspan(index), blockCount, bits, deltas);
+      index += (blockCount * bits + 7) / 8;
+
+      // undo the zigzag encoding and then the deltas
+      for (size_t j = 0; j < blockCount; j++)
+      {
+        deltas[j] = (deltas[j] >> 1) ^ (~(deltas[j] & 1) + 1);
+      }
+
+      if constexpr (isDirect)
+      {
+        const auto values = std::ranges::data(aRange) + i;
+        for (size_t j = 0; j < blockCount; j++)
+        {
+          previous += deltas[j];
+          values[j] = type_value(previous);
+        }
+      }
+      else
+      {
+        for (size_t j = 0; j < blockCount; j++)
+        {
+          previous += deltas[j];
+          aRange.insert(std::ranges::cend(aRange), type_value(previous));
+        }
+      }
+    }
+
+    return sizeof(type_size) * 2 + blocksSize;
+  }
+
+private:
+  /**
+   * @brief Calls the callback with the zigzag encoded deltas of every block and their bits count
+   * @param aRange the range
+   * @param aCallback the callback that receives the deltas, their count and their bits count
+   */
+  template <typename Callback>
+  static void ForEachBlock(const Range & aRange, Callback && aCallback)
+  {
+    uint64_t previous = std::ranges::empty(aRange) ? 0 : FindFirst(aRange);
+    uint64_t deltas[kBlockSize]{};
+    size_t   count{};
+    uint64_t bitsMask{};  // all the deltas ORed to find the widest one
+
+    for (const auto & value : aRange)
+    {
+      // the values are widened with their sign so the deltas of signed types are small too
+      const auto current = uint64_t(int64_t(value));
+      const auto delta   = int64_t(current - previous);
+      previous           = current;
+
+      deltas[count] = (uint64_t(delta) << 1) ^ uint64_t(delta >> 63);
+      bitsMask |= deltas[count++];
+
+      if (count == kBlockSize)
+      {
+        aCallback(deltas, count, size_t(std::bit_width(bitsMask)));
+        count    = {};
+        bitsMask = {};
+      }
+    }
+
+    if (count)
+    {
+      aCallback(deltas, count, size_t(std::bit_width(bitsMask)));
+    }
+  }
+
+  /**
+   * @brief Finds the first element of a range that is not empty widened with it's sign
+   * @param aRange the range
+   * @return the first element
+   */
+  static [[nodiscard]] uint64_t FindFirst(const Range & aRange) noexcept
+  {
+    return uint64_t(int64_t(*std::ranges::begin(aRange)));
+  }
+
+  /**
+   * @brief Packs the deltas with the bits count and appends them to the stream
+   * @param aDeltas the deltas
+   * @param aCount the deltas count
+   * @param aBits the bits count of every delta
+   * @param aStream the stream
+   */
+  static void Pack(const uint64_t * aDeltas, const size_t aCount, const size_t aBits,
+                   type_stream & aStream)
+  {
+    uint64_t bits{};
+    size_t   bitsCount{};  // always less than 8 between deltas
+    for (size_t i = 0; i < aCount; i++)
+    {
+      bits |= aDeltas[i] << bitsCount;
+      // the delta's bits that didn't fit in the 64 bits
+      auto bitsHigh = bitsCount && bitsCount + aBits > 64 ? aDeltas[i] >> (64 - bitsCount) : 0;
+
+      bitsCount += aBits;
+      while (bitsCount >= 8)
+      {
+        aStream.push_back(uint8_t(bits));
+        bits = (bits >> 8) | (bitsHigh << 56);
+        bitsHigh >>= 8;
+        bitsCount -= 8;
+      }
+    }
+
+    if (bitsCount)
+    {
+      aStream.push_back(uint8_t(bits));
+    }
+  }
+
+  /**
+   * @brief Unpacks the deltas with the bits count from the stream
+   * @note The block is copied to a zero padded buffer so the unpacking doesn't check bounds
+   * @param aStream the stream that starts with the packed deltas
+   * @param aCount the deltas count
+   * @param aBits the bits count of every delta
+   * @param aDeltas the unpacked deltas
+   */
+  static void Unpack(std::span<const uint8_t> aStream, const size_t aCount, const size_t aBits,
+                     uint64_t * aDeltas) noexcept
+  {
+    static constexpr auto kUnpackers = []<size_t... aBitsAll>(std::index_sequence<aBitsAll...>)
+    {
+      return std::array{ &UnpackBits<aBitsAll>... };
+    }(std::make_index_sequence<65>());
+
+    // 8 deltas take exactly aBits bytes and a delta is loaded with at most 9 bytes
+    uint8_t    bytes[kBlockSize * sizeof(uint64_t) + sizeof(uint64_t) + 1]{};
+    const auto size = (aCount * aBits + 7) / 8;
+    std::memcpy(bytes, aStream.data(), size);
+
+    kUnpackers[aBits](bytes, aCount, aDeltas);
+  }
+
+  /**
+   * @brief Unpacks the deltas with a known bits count, 8 at a time so every shift is known too
+   * @tparam aBits the bits count of every delta
+   * @param aBytes the zero padded packed deltas
+   * @param aCount the deltas count
+   * @param aDeltas the unpacked deltas that must have room for aCount rounded up to 8 deltas
+   */
+  template <size_t aBits>
+  static void UnpackBits(const uint8_t * aBytes, const size_t aCount, uint64_t * aDeltas) noexcept
+  {
+    constexpr auto mask = aBits == 64 ? ~uint64_t{} : (uint64_t(1) << aBits) - 1;
+
+    for (size_t i = 0; i < aCount; i += 8, aBytes += aBits)
+    {
+      for (size_t j = 0; j < 8; j++)
+      {
+        const auto bitIndex  = j * aBits;
+        const auto byteIndex = bitIndex / 8;
+        const auto bitShift  = bitIndex % 8;
+
+        auto delta = Load(aBytes + byteIndex) >> bitShift;
+        // a delta that doesn't start at a byte boundary may span 9 bytes
+        if constexpr (aBits > 56)
+        {
+          if (bitShift && bitShift + aBits > 64)
+          {
+            delta |= uint64_t(aBytes[byteIndex + 8]) << (64 - bitShift);
+          }
+        }
+
+        aDeltas[i + j] = delta & mask;
+      }
+    }
+  }
+
+  /**
+   * @brief Loads 8 bytes as a little endian integer
+   * @param aBytes the bytes
+   * @return the integer
+   */
+  static [[nodiscard]] uint64_t Load(const uint8_t * aBytes) noexcept
+  {
+    uint64_t value{};
+    if constexpr (std::endian::native == std::endian::little)
+    {
+      std::memcpy(&value, aBytes, sizeof(value));
+    }
+    else
+    {
+      for (size_t i = 0; i < sizeof(value); i++)
+      {
+        value |= uint64_t(aBytes[i]) << (i * 8);
+      }
+    }
+
+    return value;
+  }
+};
+
+#ifdef ISTREAMABLE_INSTRUMENTATION
+/**
+ * @brief Records the cost of the encodes and decodes of every streamable type in per thread
+ * counters that can be aggregated and dumped
+ * @note It's compiled only if ISTREAMABLE_INSTRUMENTATION is defined before the header is
+ * included, otherwise the hooks expand to nothing
+ * @note A nested streamable is counted for it's own type too, so the parent's time and bytes
+ * include the ones of it's nested streamables
+ */
+class StreamableInstrumentation
+{
+public:
+  /**
+   * @brief The counters of a streamable type
+   */
+  struct Counters
+  {
+    uint64_t mEncodes{};
+    uint64_t mEncodeBytes{};
+    uint64_t mEncodeNanoseconds{};
+    // the encodes whose stream outgrew the size reserved from GetObjectsSize, so it had to be
+    // reallocated at least once (a wrong GetObjectsSize or a streamable changed while encoded)
+    uint64_t mEncodesOverReserve{};
+    uint64_t mDecodes{};
+    uint64_t mDecodeBytes{};
+    uint64_t mDecodeNanoseconds{};
+    uint64_t mDecodeAllocations{};  // the estimated allocations of the decoded containers
+
+    Counters & operator+=(const Counters & aCounters) noexcept
+    {
+      mEncodes += aCounters.mEncodes;
+      mEncodeBytes += aCounters.mEncodeBytes;
+      mEncodeNanoseconds += aCounters.mEncodeNanoseconds;
+      mEncodesOverReserve += aCounters.mEncodesOverReserve;
+      mDecodes += aCounters.mDecodes;
+      mDecodeBytes += aCounters.mDecodeBytes;
+      mDecodeNanoseconds += aCounters.mDecodeNanoseconds;
+      mDecodeAllocations += aCounters.mDecodeAllocations;
+      return *this;
+    }
+  };
+
+  using type_counters = std::map<std::type_index, Counters>;
+
+  /**
+   * @brief Measures an encode from the streamable's ToStream, the nested calls of the base
+   * classes' ToStream on the same streamable are ignored
+   */
+  class EncodeProbe
+  {
+  public:
+    template <typename Type>
+    constexpr explicit EncodeProbe(Type & aStreamable) noexcept
+      : mStreamable(&aStreamable)
+    {
+      if (std::is_constant_evaluated() || (sProbe && sProbe->mStreamable == mStreamable))
+      {
+        return;
+      }
+
+      // the stream is not released until ToStream returns so it's size can be found at the end
+      mStream   = &aStreamable.mStream;
+      mType     = &typeid(aStreamable);
+      mPrevious = std::exchange(sProbe, this);
+      mStart    = std::chrono::steady_clock::now();
+    }
+
+    constexpr ~EncodeProbe() noexcept
+    {
+      if (!mStream)
+      {
+        return;
+      }
+
+      auto & counters = FindCounters(*mType);
+      Add(counters.mEncodes, 1);
+      Add(counters.mEncodeBytes, mStream->size());
+      Add(counters.mEncodeNanoseconds, FindNanoseconds(mStart));
+      Add(counters.mEncodesOverReserve, mStream->size() > mReserved);
+
+      sProbe = mPrevious;
+    }
+
+  private:
+    friend class StreamableInstrumentation;
+
+    const void *                          mStreamable{};
+    const std::vector<uint8_t> *          mStream{};  // null if the probe is ignored
+    const std::type_info *                mType{};
+    EncodeProbe *                         mPrevious{};
+    std::chrono::steady_clock::time_point mStart{};
+    size_t                                mReserved{};
+  };
+
+  /**
+   * @brief The start of a decode that is stored in the streamable until it's objects were read
+   * @note It doesn't take part in comparisons because it's not a part of the object
+   */
+  struct DecodeStart
+  {
+    std::chrono::steady_clock::time_point mTime{};
+    uint64_t                              mAllocations{};
+    bool                                  mActive{};
+
+    constexpr bool operator==(const DecodeStart &) const noexcept { return true; }
+    constexpr auto operator<=>(const DecodeStart &) const noexcept
+    {
+      return std::strong_ordering::equal;
+    }
+  };
+
+  /**
+   * @brief Sums the counters of all the threads, including the ones that exited
+   * @return the counters of every streamable type
+   */
+  static [[nodiscard]] type_counters Aggregate()
+  {
+    std::scoped_lock lock(sMutex);
+
+    auto counters(sCountersExited);
+    for (const auto thread : sThreads)
+    {
+      thread->AddTo(counters);
+    }
+
+    return counters;
+  }
+
+  /**
+   * @brief Gets the counters of the current thread
+   * @return the counters of every streamable type
+   */
+  static [[nodiscard]] type_counters GetThreadCounters()
+  {
+    type_counters counters;
+    sThread.AddTo(counters);
+    return counters;
+  }
+
+  /**
+   * @brief Writes the aggregated counters, one streamable type per line
+   * @param aStream the output stream
+   */
+  static void Dump(std::ostream & aStream)
+  {
+    for (const auto & [type, counters] : Aggregate())
+    {
+      aStream << type.name() << ": encodes " << counters.mEncodes << ", encode bytes "
+              << counters.mEncodeBytes << ", encode ns " << counters.mEncodeNanoseconds
+              << ", encodes over reserve " << counters.mEncodesOverReserve << ", decodes "
+              << counters.mDecodes << ", decode bytes " << counters.mDecodeBytes
+              << ", decode ns " << counters.mDecodeNanoseconds << ", decode allocations "
+              << counters.mDecodeAllocations << '\n';
+    }
+  }
+
+private:
+  friend class IStreamable;
+
+  /**
+   * @brief The counters of a streamable type that are written by their thread only, so they
+   * are atomic just to be read by Aggregate
+   */
+  struct AtomicCounters
+  {
+    std::atomic<uint64_t> mEncodes{};
+    std::atomic<uint64_t> mEncodeBytes{};
+    std::atomic<uint64_t> mEncodeNanoseconds{};
+    std::atomic<uint64_t> mEncodesOverReserve{};
+    std::atomic<uint64_t> mDecodes{};
+    std::atomic<uint64_t> mDecodeBytes{};
+    std::atomic<uint64_t> mDecodeNanoseconds{};
+    std::atomic<uint64_t> mDecodeAllocations{};
+
+    [[nodiscard]] Counters Load() const noexcept
+    {
+      return { mEncodes.load(std::memory_order_relaxed),
+               mEncodeBytes.load(std::memory_order_relaxed),
+               mEncodeNanoseconds.load(std::memory_order_relaxed),
+               mEncodesOverReserve.load(std::memory_order_relaxed),
+               mDecodes.load(std::memory_order_relaxed),
+               mDecodeBytes.load(std::memory_order_relaxed),
+               mDecodeNanoseconds.load(std::memory_order_relaxed),
+               mDecodeAllocations.load(std::memory_order_relaxed) };
+    }
+  };
+
+  /**
+   * @brief The counters of a thread that are registered while the thread runs
+   */
+  class Thread
+  {
+  public:
+    Thread()
+    {
+      std::scoped_lock lock(sMutex);
+      sThreads.push_back(this);
+    }
+
+    ~Thread()
+    {
+      std::scoped_lock lock(sMutex);
+      AddTo(sCountersExited);
+      std::erase(sThreads, this);
+    }
+
+    /**
+     * @brief Finds the counters of a streamable type adding them if they don't exist
+     * @note Just the thread itself can call it
+     * @param aType the streamable's type
+     * @return the counters
+     */
+    [[nodiscard]] AtomicCounters & FindCounters(const std::type_index aType)
+    {
+      if (const auto counters = mCounters.find(aType); counters != mCounters.end())
+      {
+        return counters->second;
+      }
+
+      // the other threads read the counters only while they hold the lock
+      std::scoped_lock lock(mMutex);
+      return mCounters.try_emplace(aType).first->second;
+    }
+
+    /**
+     * @brief Adds the counters of the thread to the counters
+     * @param aCounters the counters
+     */
+    void AddTo(type_counters & aCounters)
+    {
+      std::scoped_lock lock(mMutex);
+      for (const auto & [type, counters] : mCounters)
+      {
+        aCounters[type] += counters.Load();
+      }
+    }
+
+  private:
+    std::mutex                                          mMutex;
+    std::unordered_map<std::type_index, AtomicCounters> mCounters;
+  };
+
+  static inline std::mutex                 sMutex;
+  static inline std::vector<Thread *>      sThreads;
+  static inline type_counters              sCountersExited;
+  static inline thread_local Thread        sThread;
+  static inline thread_local EncodeProbe * sProbe{};       // the innermost encode
+  static inline thread_local uint64_t      sAllocations{};  // the allocations of all decodes
+
+  /**
+   * @brief Adds a value to a counter that is written just by the current thread
+   * @param aCounter the counter
+   * @param aValue the value
+   */
+  static void Add(std::atomic<uint64_t> & aCounter, const uint64_t aValue) noexcept
+  {
+    aCounter.store(aCounter.load(std::memory_order_relaxed) + aValue, std::memory_order_relaxed);
+  }
+
+  static [[nodiscard]] AtomicCounters & FindCounters(const std::type_index aType)
+  {
+    return sThread.FindCounters(aType);
+  }
+
+  static [[nodiscard]] uint64_t FindNanoseconds(const std::chrono::steady_clock::time_point aStart)
+  {
+    return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now() - aStart)
+                      .count());
+  }
+
+  /**
+   * @brief Remembers the size reserved for the stream of the streamable that is encoded
+   * @param aStreamable the streamable
+   * @param aSize the reserved size in bytes
+   */
+  static constexpr void OnReserve(const IStreamable & aStreamable, const size_t aSize) noexcept
+  {
+    if (!std::is_constant_evaluated() && sProbe && sProbe->mStreamable == &aStreamable)
+    {
+      sProbe->mReserved = aSize;
+    }
+  }
+
+  /**
+   * @brief Counts the estimated allocations of a decoded container
+   * @note The strings allocate if they don't fit in their small buffer, the ranges that can be
+   * reserved allocate once and the rest of the ranges allocate for every element
+   * @tparam Type the container's type
+   * @param aSize the container's number of elements
+   */
+  template <typename Type>
+  static constexpr void OnAllocations(const size_t aSize)
+  {
+    if (std::is_constant_evaluated())
+    {
+      return;
+    }
+
+    if constexpr (is_basic_string_v<Type>)
+    {
+      sAllocations += aSize > Type().capacity();
+    }
+    else if constexpr (has_method_reserve_v<Type>)
+    {
+      sAllocations += aSize != 0;
+    }
+    else
+    {
+      sAllocations += aSize;
+    }
+  }
+
+  /**
+   * @brief Starts the decode of a streamable
+   * @return the decode's start
+   */
+  static constexpr DecodeStart OnDecodeStart() noexcept
+  {
+    if (std::is_constant_evaluated())
+    {
+      return {};
+    }
+
+    return { std::chrono::steady_clock::now(), sAllocations, true };
+  }
+
+  /**
+   * @brief Ends the decode of a streamable after all it's objects were read
+   * @tparam Type the streamable's type
+   * @param aStreamable the streamable
+   * @param aStart the decode's start
+   * @param aSize the size in bytes of the streamable's stream
+   */
+  template <typename Type>
+  static constexpr void OnDecodeEnd(const Type & aStreamable, DecodeStart & aStart,
+                                    const size_t aSize)
+  {
+    if (std::is_constant_evaluated() || !aStart.mActive)
+    {
+      return;
+    }
+
+    auto & counters = FindCounters(typeid(aStreamable));
+    Add(counters.mDecodes, 1);
+    Add(counters.mDecodeBytes, aSize);
+    Add(counters.mDecodeNanoseconds, FindNanoseconds(aStart.mTime));
+    Add(counters.mDecodeAllocations, sAllocations - aStart.mAllocations);
+
+    aStart = {};
+  }
+};
+#endif
+
+/**
+ * @brief Fast and easy to use single-header parser with a simple format for C++20
+ */
+class IStreamable
+{
+  friend class StreamableSizeFinder;
+  friend class StreamableSegments;
+  friend class StreamablePatch;
+  friend class StreamableBuffer;
+  template <typename>
+  friend class StreamableAccessor;
+  friend class StreamableEncoder;
+  template <typename>
+  friend class StreamableDecoder;
+  friend class StreamableAligned;
+  ISTREAMABLE_INSTRUMENT(friend class StreamableInstrumentation;)
+
+  /*
+      Format: [4 bytes +] any data + repeat...
+
+          [4 bytes +] -> optional bytes that are available if *any data* is not a known size object
+             any data -> any continuous stream of bytes
+
+
+      ex.:
+              We have a *type* that is a uint8_t and an *ID* that is string, the *mBytes* will
+     contain:
+                  - the *type* as a stream of bytes because it's a known size object
+                  - the size in bytes of *ID* as bytes because it's not a known size object followed
+     by the *ID* as a stream of bytes
+
+
+              uint8_t type = 24;
+              string ID = "ea025860-02bd-47cb-b053-b82ca250e4ba";
+
+             1 byte   +  4 bytes  +     36 bytes
+              0x18    +   0x24    +   *ID* as bytes
+  */
+  std::vector<uint8_t> mStream{};
+
+public:
+  using type_size_sub_stream = StreamableSizeFinder::type_size_sub_stream;
+  using type_stream          = decltype(mStream);
+  using type_stream_value    = type_stream::value_type;
+
+  /**
+   * @brief Default constructor used with ToStream
+   */
+  constexpr IStreamable() noexcept = default;
+
+  /**
+   * @brief Converts the stream to an object
+   * @note Flow with simple classes: ISTREAMABLE_SERIALIZE(...) in class
+   * @note Flow with base/derived classes:
+   * base class will use ISTREAMABLE_DESERIALIZE_DERIVED_START(...)
+   * middle derived classes will use ISTREAMABLE_DESERIALIZE_DERIVED(...)
+   * last derived class will use ISTREAMABLE_DESERIALIZE_DERIVED_END(...)
+   * @param aStream the object as a rvalue stream
+   */
+  constexpr explicit IStreamable(type_stream && aStream) noexcept
+  {
+    ISTREAMABLE_INSTRUMENT(mDecodeStart = StreamableInstrumentation::OnDecodeStart());
+    Assign(move(aStream));
+  }
+
+  /**
+   * @brief Uhmm, just a destructor..
+   */
+  constexpr virtual ~IStreamable() noexcept = default;
+
+  /**
+   * @brief Converts the object to a stream
+   * @note Flow with simple classes: ISTREAMABLE_DESERIALIZE(...) in class
+   * @note Flow with base/derived classes:
+   * base class will use ISTREAMABLE_SERIALIZE_DERIVED_START(...)
+   * middle derived classes will use ISTREAMABLE_SERIALIZE_DERIVED(...)
+   * last derived class will use ISTREAMABLE_SERIALIZE_DERIVED_END(...)
+   * @return the object as a rvalue stream
+   */
+  virtual [[nodiscard]] type_stream && ToStream() = 0;
+
+  // C++20 magic
+  auto operator<=>(const IStreamable &) const = default;
+
+  /**
+   * @brief Serializes a streamable at compile time
+   * @note The streamable must be usable in constant expressions: a literal type with constexpr
+   * constructors and objects that can be streamed in constant evaluation (known size objects,
+   * strings, ranges and nested streamables)
+   * @note ex.: constexpr auto kHello = IStreamable::ToStaticStream<[] { return Hello(1, "hi"); }>();
+   * @tparam aFactory a constexpr callable that returns the streamable
+   * @return the streamable as an array of bytes
+   */
+  template <auto aFactory>
+  static [[nodiscard]] consteval auto ToStaticStream()
+  {
+    constexpr auto size = []
+    {
+      auto streamable = aFactory();
+      return streamable.ToStream().size();
+    }();
+
+    std::array<type_stream_value, size> stream{};
+    auto                                 streamable = aFactory();
+    const auto &                         streamableStream = streamable.ToStream();
+    std::copy(streamableStream.cbegin(), streamableStream.cend(), stream.begin());
+
+    return stream;
+  }
+
+  /**
+   * @brief Gets how many times the objects size was calculated in the last encode on this thread
+   * @note A tree of N streamables should need exactly N calculations
+   * @return the number of objects size calculations
+   */
+  static [[nodiscard]] size_t GetObjectsSizeComputations() noexcept
+  {
+    return sObjectsSizeComputations;
+  }
+
+protected:
+  /**
+   * @brief Gets the required size to store the object
+   */
+  virtual constexpr size_t GetObjectsSize() const noexcept = 0;
+
+#pragma region XWriteAll
+
+  /**
+   * @brief Initializes the stream and writes all the objects to it
+   * @return the rvalue stream
+   */
+  template <typename... Types>
+  [[nodiscard]] constexpr decltype(auto) InitAndWriteAll(Types &... aObjects)
+  {
+    Init();
+
+    if constexpr (sizeof...(aObjects))
+    {
+      WriteAll(aObjects...);
+    }
+
+    return Release();
+  }
+
+  /**
+   * @brief Assigns the stream and writes all the objects to it
+   * @tparam ...Types the rest of object's types
+   * @param aStream the rvalue stream
+   * @param ...aObjects the rest of object
+   * @return the rvalue stream
+   */
+  template <typename... Types>
+  [[nodiscard]] constexpr decltype(auto) AssignAndWriteAll(type_stream && aStream,
+                                                           Types &... aObjects)
+  {
+    Assign(move(aStream), false);
+
+    if constexpr (sizeof...(aObjects))
+    {
+      WriteAll(aObjects...);
+    }
+
+    return Release();
+  }
+
+  /**
+   * @brief Initializes the stream and writes all the objects to it in the packed mode
+   * @note Consecutive packed objects are written as a bit field rounded up to a byte
+   * @tparam ...Types the objects' types
+   * @param ...aObjects the objects
+   * @return the rvalue stream
+   */
+  template <typename... Types>
+  [[nodiscard]] constexpr decltype(auto) InitAndWritePackedAll(Types &... aObjects)
+  {
+    Init();
+
+    PackedBits bits{};
+    (WritePacked(bits, aObjects), ...);
+    WriteBits(bits, true);
+
+    return Release();
+  }
+
+#pragma endregion
+
+#pragma region ReadAllX
+
+  /**
+   * @brief Reads all the object from the stream
+   * @tparam Type the current object's type
+   * @tparam ...Types the rest of object's types
+   * @param aObject the current object
+   * @param ...aObjects the rest of object
+   */
+  template <typename Type, typename... Types>
+  constexpr void ReadAll(Type & aObject, Types &... aObjects)
+  {
+    aObject = Read<Type>();
+
+    if constexpr (sizeof...(aObjects))
+    {
+      ReadAll(aObjects...);
+    }
+  }
+
+  /**
+   * @brief Reads the objects from the stream and clears it
+   * @tparam ...Types the objects's type
+   * @param ...aObjects the object be read
+   */
+  template <typename... Types>
+  constexpr void ReadAllAndClear(Types &... aObjects) noexcept
+  {
+    if constexpr (sizeof...(aObjects))
+    {
+      ReadAll(aObjects...);
+    }
+
+    ISTREAMABLE_INSTRUMENT(
+      StreamableInstrumentation::OnDecodeEnd(*this, mDecodeStart, mStream.size()));
+    Clear();
+  }
+
+  /**
+   * @brief Reads the objects from the stream in the packed mode and clears it
+   * @tparam ...Types the objects's type
+   * @param ...aObjects the object be read
+   */
+  template <typename... Types>
+  constexpr void ReadPackedAllAndClear(Types &... aObjects)
+  {
+    PackedBits bits{};
+    (ReadPacked(bits, aObjects), ...);
+
+    ISTREAMABLE_INSTRUMENT(
+      StreamableInstrumentation::OnDecodeEnd(*this, mDecodeStart, mStream.size()));
+    Clear();
+  }
+
+#pragma endregion
+
+private:
+  /**
+   * @brief The bits of a bit field that are not written or read yet
+   */
+  struct PackedBits
+  {
+    uint64_t mBits{};
+    size_t   mCount{};
+  };
+
+  /**
+   * @brief The objects size calculated in an encode that is reused until the encode ends
+   * @note It doesn't take part in comparisons because it's not a part of the object
+   * @note It's not copied with the object, a copy or an assigned object calculates it again
+   */
+  struct ObjectsSizeCache
+  {
+    size_t mSize{};
+    size_t mEncode{};  // the encode in which the size was calculated, 0 means never
+
+    constexpr ObjectsSizeCache() noexcept = default;
+    constexpr ObjectsSizeCache(const ObjectsSizeCache &) noexcept {}
+    constexpr ObjectsSizeCache(ObjectsSizeCache &&) noexcept {}
+
+    constexpr ObjectsSizeCache & operator=(const ObjectsSizeCache &) noexcept
+    {
+      mEncode = {};
+      return *this;
+    }
+
+    constexpr ObjectsSizeCache & operator=(ObjectsSizeCache &&) noexcept
+    {
+      mEncode = {};
+      return *this;
+    }
+
+    constexpr bool operator==(const ObjectsSizeCache &) const noexcept { return true; }
+    constexpr auto operator<=>(const ObjectsSizeCache &) const noexcept
+    {
+      return std::strong_ordering::equal;
+    }
+  };
+
+  /**
+   * @brief Marks the lifetime of an encode, the outermost one starts a new encode
+   */
+  class EncodeScope
+  {
+  public:
+    constexpr EncodeScope(const bool aNewEncode = false) noexcept
+    {
+      if (std::is_constant_evaluated())
+      {
+        return;
+      }
+
+      if (aNewEncode && !sEncodeDepth)
+      {
+        sEncode = Start();
+      }
+
+      sEncodeDepth++;
+    }
+
+    /**
+     * @brief Continues an encode that is done in parts (ex.: by a suspended coroutine)
+     * @note The outermost one enters the encode, starting it if it's id is 0, so the sizes
+     * cached by the previous parts are reused
+     * @param aEncode the encode's id
+     */
+    constexpr EncodeScope(size_t & aEncode) noexcept
+    {
+      if (std::is_constant_evaluated())
+      {
+        return;
+      }
+
+      if (!sEncodeDepth)
+      {
+        if (!aEncode)
+        {
+          aEncode = Start();
+        }
+
+        sEncode = aEncode;
+      }
+
+      sEncodeDepth++;
+    }
+
+    constexpr ~EncodeScope() noexcept
+    {
+      if (!std::is_constant_evaluated())
+      {
+        sEncodeDepth--;
+      }
+    }
+
+  private:
+    /**
+     * @brief Starts a new encode
+     * @note The ids are unique across the threads so a size cached on another thread is never
+     * reused
+     * @return the new encode's id
+     */
+    static [[nodiscard]] size_t Start() noexcept
+    {
+      sObjectsSizeComputations = {};
+      return sEncodes.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+  };
+
+  static inline std::atomic<size_t> sEncodes{};       // the encodes started by all the threads
+  static inline thread_local size_t  sEncode{};        // the current encode on this thread
+  static inline thread_local size_t  sEncodeDepth{};   // how many encodes are nested
+  static inline thread_local size_t  sObjectsSizeComputations{};
+
+  size_t                   mIndex{};
+  mutable ObjectsSizeCache mObjectsSizeCache{};
+
+  ISTREAMABLE_INSTRUMENT(StreamableInstrumentation::DecodeStart mDecodeStart{};)
+
+  /**
+   * @brief Gets the required size to store the object calculating it once per encode
+   * @note Outside of an encode the size is always calculated because the object may change
+   * @return the required size to store the object
+   */
+  constexpr size_t FindObjectsSize() const noexcept
+  {
+    if (std::is_constant_evaluated() || !sEncodeDepth)
+    {
+      return GetObjectsSize();
+    }
+
+    if (mObjectsSizeCache.mEncode != sEncode)
+    {
+      mObjectsSizeCache.mSize   = GetObjectsSize();
+      mObjectsSizeCache.mEncode = sEncode;
+      sObjectsSizeComputations++;
+    }
+
+    return mObjectsSizeCache.mSize;
+  }
+
+  /**
+   * @brief Allocates memory for the fixed size stream
+   * @note Finds the size automatically for derived classes
+   * @note Starts a new encode if it's not a part of one so the nested streamables' sizes
+   * calculated now are reused when they are written
+   */
+  constexpr void Init()
+  {
+    mStream = type_stream();
+    {
+      EncodeScope encodeScope(true);
+      const auto size = FindObjectsSize();
+      mStream.reserve(size);
+      ISTREAMABLE_INSTRUMENT(StreamableInstrumentation::OnReserve(*this, size));
+    }
+    mIndex = {};
+  }
+
+  /**
+   * @brief Assigns the stream
+   * @param aStream the rvalue stream
+   * @param aReset should reset the stream's index
+   */
+  constexpr void Assign(type_stream && aStream, const bool aReset = true) noexcept
+  {
+    if (aReset)
+    {
+      mIndex = {};
+    }
+
+    // derived classes assign the stream released by their base which is our own stream
+    if (&aStream != &mStream)
+    {
+      mStream = move(aStream);
+    }
+  }
+
+  /**
+   * @brief Releases the stream
+   * @return the rvalue stream
+   */
+  [[nodiscard]] constexpr decltype(auto) Release() noexcept { return move(mStream); }
+
+  /**
+   * @brief Clears the stream and it's index
+   */
+  constexpr void Clear() noexcept
+  {
+    mStream.clear();
+    mIndex = {};
+  }
+
+#pragma region WriteX
+
+  /**
+   * @brief Writes the size as bytes to the stream
+   * @param aSize the size
+   */
+  constexpr void WriteSize(const type_size_sub_stream aSize)
+  {
+    // write the stream's size as bytes
+    WriteBytes(&aSize, 1);
+  }
+
+  /**
+   * @brief Writes the objects as bytes to the stream
+   * @note In constant evaluation the objects are converted with std::bit_cast because
+   * reinterpret_cast is not allowed
+   * @tparam Type the objects' type that must be a known size type
+   * @param aObjects the objects
+   * @param aCount the number of objects
+   */
+  template <typename Type>
+  constexpr void WriteBytes(const Type * aObjects, const size_t aCount)
+  {
+    if (std::is_constant_evaluated())
+    {
+      for (size_t i = 0; i < aCount; i++)
+      {
+        const auto bytes = std::bit_cast<std::array<type_stream_value, sizeof(Type)>>(aObjects[i]);
+        mStream.insert(mStream.end(), bytes.cbegin(), bytes.cend());
+      }
+    }
+    else
+    {
+      const auto streamPtr = reinterpret_cast<const type_stream_value *>(aObjects);
+      mStream.insert(mStream.end(), streamPtr, streamPtr + aCount * sizeof(Type));
+    }
+
+    mIndex += aCount * sizeof(Type);
+  }
+
+  /**
+   * @brief Writes all the object in the stream
+   * @tparam Type the current object's type
+   * @tparam ...Types the rest of object's types
+   * @param aObject the current object
+   * @param ...aObjects the rest of object
+   */
+  template <typename Type, typename... Types>
+  constexpr void WriteAll(Type & aObject, Types &... aObjects)
+  {
+    Write(aObject);
+
     if constexpr (sizeof...(aObjects))
     {
-      WriteAll(aObjects...);
+      WriteAll(aObjects...);
+    }
+  }
+
+  /**
+   * @brief Writes the object in the stream
+   * @tparam Type the object's type
+   * @param aObject the object
+   * @param aSize the object's size in bytes
+   * @note aSize is required for unhandled types
+   */
+  template <typename Type = void *>
+  constexpr void Write(Type & aObject, const type_size_sub_stream aSize = 0)
+  {
+    StreamableSizeFinder::AssertAccepted<Type>();
+
+    if constexpr (is_basic_string_v<Type>)
+    {
+      WriteSize(type_size_sub_stream(aObject.size() * sizeof(Type::value_type)));
+      WriteBytes(aObject.data(), aObject.size());
+    }
+    else if constexpr (std::is_same_v<std::remove_cvref_t<Type>, std::filesystem::path>)
+    {
+      const auto wstr(aObject.wstring());
+      Write(wstr);
+    }
+    else if constexpr (is_known_size_v<Type>)
+    {
+      WriteObjectOfKnownSize(aObject);
+    }
+    else if constexpr (std::is_base_of_v<IStreamable, Type>)
+    {
+      WriteStreamable(aObject);
+    }
+    else if constexpr (is_columnar_range_v<Type>)
+    {
+      WriteColumns(aObject);
+    }
+    else if constexpr (is_delta_range_v<Type>)
+    {
+      mIndex += Type::Encode(aObject, mStream);
+    }
+    // last check because types like string and path are ranges
+    else if constexpr (std::ranges::range<Type>)
+    {
+      WriteRange(aObject);
+    }
+    else
+    {
+      WriteObject(&aObject, aSize);
+    }
+  }
+
+  /**
+   * @brief Writes a number of bytes from stream
+   * @param aStream the stream
+   * @param aSize the number of bytes to write
+   */
+  void WriteObject(const void * aStream, const type_size_sub_stream aSize)
+  {
+    WriteSize(aSize);
+
+    // write the stream
+    const auto streamPtr = reinterpret_cast<const type_stream_value *>(aStream);
+    mStream.insert(mStream.end(), streamPtr, streamPtr + aSize);
+    mIndex += aSize;
+  }
+
+  /**
+   * @brief Writes an object that directly implements IStreamable
+   * @param aStreamable the IStreamable object
+   */
+  constexpr void WriteStreamable(IStreamable & aStreamable)
+  {
+    // starts a new encode if it's not a part of one (ex.: a streamable written directly to a
+    // StreamableBuffer) so the size cached by a previous encode is not reused
+    EncodeScope encodeScope(true);
+
+    const auto streamableSize = aStreamable.FindObjectsSize();
+    WriteSize(type_size_sub_stream(streamableSize));
+    auto stream(aStreamable.ToStream());
+    assert(stream.size() == streamableSize);
+
+    // write the streamable
+    mStream.insert(mStream.end(), stream.cbegin(), stream.cend());
+    mIndex += streamableSize;
+  }
+
+  /**
+   * @brief Writes an object as bytes to the stream
+   * @note the object's type must be a known size type
+   * @tparam Type the object's type
+   * @param aObject the object
+   */
+  template <typename Type>
+  constexpr void WriteObjectOfKnownSize(const Type & aObject)
+  {
+    static_assert(is_known_size_v<Type>, "The object's type must be a known size type!");
+    WriteBytes(&aObject, 1);
+  }
+
+  /**
+   * @brief Writes any nested range to the stream
+   * @tparam Type the nested range object type
+   */
+  template <std::ranges::range Range>
+  constexpr void WriteRange(Range & aRange)
+  {
+    WriteSize(type_size_sub_stream(std::ranges::size(aRange)));
+    if constexpr (!is_accepted_no_range_v<Range> &&
+                  StreamableSizeFinder::FindRangeLayersCount<Range>() > 1)
+    {
+      std::ranges::for_each(aRange,
+                            [this](auto && aObject)
+                            {
+                              WriteRange(aObject);
+                            });
+    }
+    else
+    {
+      std::ranges::for_each(aRange,
+                            [this](auto && aObject)
+                            {
+                              Write(aObject);
+                            });
+    }
+  }
+
+  /**
+   * @brief Writes a columnar range to the stream column by column
+   * @tparam Range the columnar range's type
+   * @param aRange the columnar range
+   */
+  template <typename Range>
+  constexpr void WriteColumns(Range & aRange)
+  {
+    WriteSize(type_size_sub_stream(std::ranges::size(aRange)));
+
+    [&]<size_t... aIndexes>(std::index_sequence<aIndexes...>)
+    {
+      (WriteColumn<aIndexes>(aRange), ...);
+    }(std::make_index_sequence<std::tuple_size_v<typename Range::type_columns>>());
+  }
+
+  /**
+   * @brief Writes a column of a columnar range to the stream
+   * @tparam aIndex the column's index in the element's objects
+   * @tparam Range the columnar range's type
+   * @param aRange the columnar range
+   */
+  template <size_t aIndex, typename Range>
+  constexpr void WriteColumn(Range & aRange)
+  {
+    using type_column = typename Range::template type_column<aIndex>;
+
+    if constexpr (is_known_size_v<type_column>)
+    {
+      const auto columnSize = std::ranges::size(aRange) * sizeof(type_column);
+      WriteSize(type_size_sub_stream(columnSize));
+
+      // gather the members in a contiguous array
+      mStream.resize(mStream.size() + columnSize);
+      auto streamPtr = mStream.data() + mStream.size() - columnSize;
+      for (const auto & row : aRange)
+      {
+        std::memcpy(streamPtr, &std::get<aIndex>(row.GetObjects()), sizeof(type_column));
+        streamPtr += sizeof(type_column);
+      }
+      mIndex += columnSize;
+    }
+    else
+    {
+      // the column's size is known only after writing it so patch it afterwards
+      const auto sizePosition = mStream.size();
+      WriteSize({});
+      for (auto & row : aRange)
+      {
+        Write(std::get<aIndex>(row.GetObjects()));
+      }
+
+      const auto columnSize =
+        type_size_sub_stream(mStream.size() - sizePosition - sizeof(type_size_sub_stream));
+      std::memcpy(mStream.data() + sizePosition, &columnSize, sizeof(columnSize));
+    }
+  }
+
+  /**
+   * @brief Writes the object in the packed mode
+   * @tparam Type the object's type
+   * @param aBits the bit field's bits that are not written yet
+   * @param aObject the object
+   */
+  template <typename Type>
+  constexpr void WritePacked(PackedBits & aBits, Type & aObject)
+  {
+    using type_object = std::remove_cvref_t<Type>;
+
+    if constexpr (constexpr auto bits = packed_bits_v<type_object>)
+    {
+      static_assert(bits <= 56, "A packed object can have at most 56 bits!");
+
+      uint64_t value{};
+      if constexpr (std::is_enum_v<type_object>)
+      {
+        value = uint64_t(std::underlying_type_t<type_object>(aObject));
+      }
+      else
+      {
+        value = uint64_t(aObject);
+      }
+
+      aBits.mBits |= (value & ((uint64_t(1) << bits) - 1)) << aBits.mCount;
+      aBits.mCount += bits;
+      WriteBits(aBits);
+    }
+    else
+    {
+      // the bit field ends here
+      WriteBits(aBits, true);
+
+      if constexpr (is_bool_vector_v<type_object>)
+      {
+        WriteBoolVector(aObject);
+      }
+      else
+      {
+        Write(aObject);
+      }
+    }
+  }
+
+  /**
+   * @brief Writes the whole bytes of a bit field
+   * @param aBits the bit field's bits that are not written yet
+   * @param aEnd should write the last incomplete byte too
+   */
+  constexpr void WriteBits(PackedBits & aBits, const bool aEnd = false)
+  {
+    while (aBits.mCount >= 8 || (aEnd && aBits.mCount))
+    {
+      mStream.push_back(type_stream_value(aBits.mBits));
+      mIndex++;
+
+      aBits.mBits >>= 8;
+      aBits.mCount = aBits.mCount >= 8 ? aBits.mCount - 8 : 0;
+    }
+  }
+
+  /**
+   * @brief Writes a vector of bools as bits, 64 bools at a time
+   * @note The vector's words are copied at once when the standard library exposes them (see
+   * FindBoolVectorBytes), otherwise every 64 bools are packed in a word that is written as 8
+   * little endian bytes and just the last incomplete word is written byte by byte
+   * @param aVector the vector of bools
+   */
+  constexpr void WriteBoolVector(const std::vector<bool> & aVector)
+  {
+    const auto size = aVector.size();
+    WriteSize(type_size_sub_stream(size));
+
+    if (!std::is_constant_evaluated())
+    {
+      if (const auto bytes = FindBoolVectorBytes(aVector))
+      {
+        mStream.insert(mStream.end(), bytes, bytes + (size + 7) / 8);
+        mIndex += (size + 7) / 8;
+
+        // the bits after the last bool are not guaranteed to be 0
+        if (size % 8)
+        {
+          mStream.back() &= type_stream_value((1 << size % 8) - 1);
+        }
+        return;
+      }
+    }
+
+    const auto words = size / 64;
+    auto       bit   = aVector.cbegin();
+    for (size_t i = 0; i < words; i++)
+    {
+      uint64_t word{};
+      for (size_t j = 0; j < 64; j++, ++bit)
+      {
+        word |= uint64_t(*bit) << j;
+      }
+
+      if constexpr (std::endian::native == std::endian::big)
+      {
+        word = ByteSwap(word);
+      }
+
+      const auto bytes = std::bit_cast<std::array<type_stream_value, sizeof(word)>>(word);
+      mStream.insert(mStream.end(), bytes.cbegin(), bytes.cend());
+      mIndex += sizeof(word);
+    }
+
+    const auto count = size % 64;
+    if (!count)
+    {
+      return;
+    }
+
+    uint64_t word{};
+    for (size_t j = 0; j < count; j++, ++bit)
+    {
+      word |= uint64_t(*bit) << j;
+    }
+
+    for (size_t byte = 0; byte < (count + 7) / 8; byte++)
+    {
+      mStream.push_back(type_stream_value(word >> (byte * 8)));
+    }
+    mIndex += (count + 7) / 8;
+  }
+
+  /**
+   * @brief Reverses the bytes of a word
+   * @param aWord the word
+   * @return the word with the bytes reversed
+   */
+  static [[nodiscard]] constexpr uint64_t ByteSwap(uint64_t aWord) noexcept
+  {
+    uint64_t word{};
+    for (size_t i = 0; i < sizeof(aWord); i++, aWord >>= 8)
+    {
+      word = (word << 8) | (aWord & 0xFF);
+    }
+
+    return word;
+  }
+
+  /**
+   * @brief Finds the bytes of the words that store the bools of a vector
+   * @note The words of libstdc++ and MSVC's STL store the bools from their lowest bit, so on a
+   * little endian machine their bytes are the bools packed in bits exactly as they are streamed
+   * @param aVector the vector of bools
+   * @return the bytes or nullptr if the standard library doesn't expose them
+   */
+  static [[nodiscard]] const type_stream_value * FindBoolVectorBytes(
+    const std::vector<bool> & aVector) noexcept
+  {
+    return FindBoolVectorBytes(const_cast<std::vector<bool> &>(aVector));
+  }
+
+  /**
+   * @brief Finds the bytes of the words that store the bools of a vector
+   * @param aVector the vector of bools
+   * @return the bytes or nullptr if the standard library doesn't expose them
+   */
+  static [[nodiscard]] type_stream_value * FindBoolVectorBytes(std::vector<bool> & aVector) noexcept
+  {
+    if constexpr (std::endian::native == std::endian::little)
+    {
+#if defined(_MSVC_STL_VERSION)
+      return reinterpret_cast<type_stream_value *>(aVector._Myvec.data());
+#elif defined(__GLIBCXX__)
+      return reinterpret_cast<type_stream_value *>(aVector.begin()._M_p);
+#endif
+    }
+
+    return nullptr;
+  }
+
+#pragma endregion
+
+#pragma region ReadX
+  /**
+   * @brief Reads the size of the current sub stream inside the stream
+   * @return the current sub stream size
+   */
+  [[nodiscard]] decltype(auto) ReadSize() noexcept
+  {
+    const auto sizePtr = reinterpret_cast<type_size_sub_stream *>(mStream.data() + mIndex);
+    mIndex += sizeof(type_size_sub_stream);
+    return *sizePtr;
+  }
+
+  /**
+   * @brief Reads the object from the stream
+   * @note for unhandled object types will return a span
+   * @tparam Type the object's type
+   * @return the object
+   */
+  template <typename Type = std::span<type_stream_value>>
+  [[nodiscard]] constexpr decltype(auto) Read()
+  {
+    StreamableSizeFinder::AssertAccepted<Type>();
+
+    if constexpr (is_basic_string_v<Type>)
+    {
+      const auto [ptr, size] = ReadStream<Type>();
+      ISTREAMABLE_INSTRUMENT(StreamableInstrumentation::OnAllocations<Type>(size));
+      return Type(ptr, size);
+    }
+    else if constexpr (std::is_same_v<std::remove_cvref_t<Type>, std::filesystem::path>)
+    {
+      const auto [ptr, size] = ReadStream<std::wstring>();
+      ISTREAMABLE_INSTRUMENT(StreamableInstrumentation::OnAllocations<std::wstring>(size));
+      return std::wstring(ptr, size);
+    }
+    // is_known_size_v is true for span but we want the last branch for spans so:
+    else if constexpr (is_known_size_v<Type> &&
+                       !std::is_same_v<Type, std::span<type_stream_value>>)
+    {
+      return ReadObjectOfKnownSize<Type>();
+    }
+    else if constexpr (std::is_base_of_v<IStreamable, Type>)
+    {
+      return ReadStreamable<Type>();
+    }
+    else if constexpr (is_columnar_range_v<Type>)
+    {
+      return ReadColumns<Type>();
+    }
+    else if constexpr (is_delta_range_v<Type>)
+    {
+      Type range{};
+      mIndex += Type::Decode({ mStream.data() + mIndex, mStream.size() - mIndex }, range);
+      ISTREAMABLE_INSTRUMENT(
+        StreamableInstrumentation::OnAllocations<Type>(std::ranges::size(range)));
+      return range;
+    }
+    // last check because types like string and path are ranges
+    else if constexpr (std::ranges::range<Type>)
+    {
+      return ReadRange<Type>();
+    }
+    else
+    {
+      return ReadObject();
+    }
+  }
+
+  /**
+   * @brief Reads an object that directly implements IStreamable
+   * @tparam Type object's type that directly implements IStreamable
+   * @return the IStreamable object
+   */
+  template <typename Type, std::enable_if_t<std::is_base_of_v<IStreamable, Type>, bool> = true>
+  [[nodiscard]] constexpr decltype(auto) ReadStreamable() noexcept
+  {
+    const auto streamableSize = ReadSize();
+    Type streamable({ mStream.cbegin() + mIndex, mStream.cbegin() + mIndex + streamableSize });
+    mIndex += streamableSize;
+
+    return streamable;
+  }
+
+  /**
+   * @brief Reads any nested range from the stream
+   * @tparam Type the nested range object type
+   * @return the nested range object
+   */
+  template <std::ranges::range Range>
+  [[nodiscard]] constexpr decltype(auto) ReadRange()
+  {
+    Range      range{};
+    const auto size = ReadSize();
+    ISTREAMABLE_INSTRUMENT(StreamableInstrumentation::OnAllocations<Range>(size));
+    if constexpr (has_method_reserve_v<Range>)
+    {
+      range.reserve(size);
+    }
+
+    if constexpr (StreamableSizeFinder::FindRangeLayersCount<Range>() > 1)
+    {
+      for (size_t i = 0; i < size; i++)
+      {
+        range.insert(std::ranges::cend(range), ReadRange<typename Range::value_type>());
+      }
+    }
+    else
+    {
+      for (size_t i = 0; i < size; i++)
+      {
+        range.insert(std::ranges::cend(range), Read<typename Range::value_type>());
+      }
+    }
+
+    return range;
+  }
+
+  /**
+   * @brief Reads the object in the packed mode
+   * @tparam Type the object's type
+   * @param aBits the bit field's bits that are not read yet
+   * @param aObject the object
+   */
+  template <typename Type>
+  constexpr void ReadPacked(PackedBits & aBits, Type & aObject)
+  {
+    if constexpr (constexpr auto bits = packed_bits_v<Type>)
+    {
+      while (aBits.mCount < bits)
+      {
+        aBits.mBits |= uint64_t(mStream[mIndex++]) << aBits.mCount;
+        aBits.mCount += 8;
+      }
+
+      const auto value = aBits.mBits & ((uint64_t(1) << bits) - 1);
+      aBits.mBits >>= bits;
+      aBits.mCount -= bits;
+
+      if constexpr (std::is_enum_v<Type>)
+      {
+        using type_underlying = std::underlying_type_t<Type>;
+
+        // the sign is the last bit for signed enums
+        auto valueSigned = value;
+        if constexpr (std::is_signed_v<type_underlying>)
+        {
+          if (value >> (bits - 1))
+          {
+            valueSigned |= ~((uint64_t(1) << bits) - 1);
+          }
+        }
+
+        aObject = Type(type_underlying(valueSigned));
+      }
+      else
+      {
+        aObject = Type(value);
+      }
+    }
+    else
+    {
+      // the bit field ended so the rest of it's bits are just padding
+      aBits = {};
+
+      if constexpr (is_bool_vector_v<Type>)
+      {
+        aObject = ReadBoolVector();
+      }
+      else
+      {
+        aObject = Read<Type>();
+      }
+    }
+  }
+
+  /**
+   * @brief Reads a vector of bools from bits, 64 bools at a time
+   * @note The bytes are copied at once to the vector's words when the standard library exposes
+   * them (see FindBoolVectorBytes), otherwise every 8 bytes are read at once as a word that is
+   * unpacked in 64 bools and just the last incomplete word is read byte by byte
+   * @return the vector of bools
+   */
+  [[nodiscard]] std::vector<bool> ReadBoolVector()
+  {
+    const size_t      size = ReadSize();
+    std::vector<bool> vector(size);
+    ISTREAMABLE_INSTRUMENT(StreamableInstrumentation::OnAllocations<std::vector<bool>>(size));
+
+    if (const auto bytes = FindBoolVectorBytes(vector))
+    {
+      std::memcpy(bytes, mStream.data() + mIndex, (size + 7) / 8);
+      mIndex += (size + 7) / 8;
+
+      // the bits after the last bool must stay 0
+      if (size % 8)
+      {
+        bytes[size / 8] &= type_stream_value((1 << size % 8) - 1);
+      }
+      return vector;
+    }
+
+    const auto words = size / 64;
+    auto       bit   = vector.begin();
+    for (size_t i = 0; i < words; i++)
+    {
+      uint64_t word{};
+      std::memcpy(&word, mStream.data() + mIndex, sizeof(word));
+      mIndex += sizeof(word);
+
+      if constexpr (std::endian::native == std::endian::big)
+      {
+        word = ByteSwap(word);
+      }
+
+      for (size_t j = 0; j < 64; j++, ++bit)
+      {
+        *bit = (word >> j) & 1;
+      }
+    }
+
+    const auto count = size % 64;
+
+    uint64_t word{};
+    for (size_t byte = 0; byte < (count + 7) / 8; byte++)
+    {
+      word |= uint64_t(mStream[mIndex++]) << (byte * 8);
+    }
+
+    for (size_t j = 0; j < count; j++, ++bit)
+    {
+      *bit = (word >> j) & 1;
+    }
+
+    return vector;
+  }
+
+  /**
+   * @brief Reads a columnar range from the stream column by column
+   * @tparam Range the columnar range's type
+   * @return the columnar range
+   */
+  template <typename Range>
+  [[nodiscard]] constexpr decltype(auto) ReadColumns()
+  {
+    static_assert(std::is_default_constructible_v<typename Range::type_row>,
+                  "The columnar range's elements must be default constructible!");
+
+    Range range{};
+    range.resize(ReadSize());
+    ISTREAMABLE_INSTRUMENT(
+      StreamableInstrumentation::OnAllocations<Range>(std::ranges::size(range)));
+
+    [&]<size_t... aIndexes>(std::index_sequence<aIndexes...>)
+    {
+      (ReadColumn<aIndexes>(range), ...);
+    }(std::make_index_sequence<std::tuple_size_v<typename Range::type_columns>>());
+
+    return range;
+  }
+
+  /**
+   * @brief Reads a column of a columnar range from the stream
+   * @tparam aIndex the column's index in the element's objects
+   * @tparam Range the columnar range's type
+   * @param aRange the columnar range with all it's elements default constructed
+   */
+  template <size_t aIndex, typename Range>
+  constexpr void ReadColumn(Range & aRange)
+  {
+    using type_column = typename Range::template type_column<aIndex>;
+
+    const auto columnSize = ReadSize();
+    if constexpr (is_known_size_v<type_column>)
+    {
+      // scatter the contiguous array to the members
+      auto streamPtr = mStream.data() + mIndex;
+      for (auto & row : aRange)
+      {
+        std::memcpy(&std::get<aIndex>(row.GetObjects()), streamPtr, sizeof(type_column));
+        streamPtr += sizeof(type_column);
+      }
+      mIndex += columnSize;
+    }
+    else
+    {
+      for (auto & row : aRange)
+      {
+        std::get<aIndex>(row.GetObjects()) = Read<type_column>();
+      }
+    }
+  }
+
+  /**
+   * @brief Reads an object from the stream
+   * @tparam Type the stream's type
+   * @return a pair containing the stream start and it's size
+   */
+  template <typename Type>
+  [[nodiscard]] constexpr decltype(auto) ReadStream() noexcept
+  {
+    const auto spen(ReadObject());
+    const auto streamType = reinterpret_cast<Type::value_type *>(spen.data());
+    const auto streamSize = spen.size_bytes() / sizeof(Type::value_type);
+
+    return std::pair{ streamType, streamSize };
+  }
+
+  /**
+   * @brief Reads an object from the stream
+   * @return a span containing the object as a stream
+   */
+  [[nodiscard]] decltype(auto) ReadObject() noexcept
+  {
+    const auto                   size = ReadSize();
+    std::span<type_stream_value> spen(mStream.data() + mIndex, size);
+    mIndex += size;
+
+    return spen;
+  }
+
+  /**
+   * @brief Reads an object from stream
+   * @note the object's type must be a known size type
+   * @return the object
+   */
+  template <typename Type>
+  [[nodiscard]] constexpr decltype(auto) ReadObjectOfKnownSize() noexcept
+  {
+    const auto objectPtr = reinterpret_cast<Type *>(mStream.data() + mIndex);
+    mIndex += sizeof(Type);
+    return *objectPtr;
+  }
+#pragma endregion
+};
+
+/**
+ * @brief A streamable without objects used to write objects to a stream and read them from it
+ * with IStreamable's methods, one at a time
+ */
+class StreamableBuffer final : public IStreamable
+{
+public:
+  using IStreamable::IStreamable;
+
+  [[nodiscard]] type_stream && ToStream() override { return Release(); }
+
+protected:
+  size_t GetObjectsSize() const noexcept override { return mStream.size(); }
+};
+
+/**
+ * @brief Serializes a streamable to a list of segments for scatter-gather I/O (writev, sendmsg...)
+ * @note The sizes are written to a small owned buffer while the big contiguous objects (strings,
+ * ranges of known size objects, big known size objects) are referenced directly from the
+ * streamable's memory, so the segments are valid as long as the streamable is not modified
+ * @note The segments' bytes are the same as the ones returned by ToStream
+ * @note The segments count is at most the maximum passed to the constructor (IOV_MAX by default)
+ * because writev/sendmsg fail for more, the objects that would exceed it are copied instead
+ */
+class StreamableSegments
+{
+public:
+#if __has_include(<sys/uio.h>)
+  using type_segment = iovec;
+#else
+  struct type_segment  // has the same layout as POSIX's iovec
+  {
+    void * iov_base;
+    size_t iov_len;
+  };
+#endif
+
+  using type_size_sub_stream = IStreamable::type_size_sub_stream;
+  using type_stream          = IStreamable::type_stream;
+  using type_stream_value    = IStreamable::type_stream_value;
+
+  static constexpr size_t kThresholdDefault = 256;  // smaller objects are copied
+#ifdef IOV_MAX
+  static constexpr size_t kSegmentsMaxDefault = IOV_MAX;
+#else
+  static constexpr size_t kSegmentsMaxDefault = 1024;  // IOV_MAX on Linux
+#endif
+
+  /**
+   * @brief Serializes the streamable to segments
+   * @tparam Type the streamable's type
+   * @param aStreamable the streamable
+   * @param aThreshold the minimum size in bytes of an object to be referenced instead of copied
+   * @param aSegmentsMax the maximum number of segments (ex.: less than IOV_MAX to leave room for
+   * the caller's own segments)
+   */
+  template <typename Type>
+  explicit StreamableSegments(Type & aStreamable, const size_t aThreshold = kThresholdDefault,
+                              const size_t aSegmentsMax = kSegmentsMaxDefault)
+    : mThreshold(aThreshold), mSegmentsMax(std::max<size_t>(aSegmentsMax, 1))
+  {
+    StreamableSizeFinder::AssertStreamable<Type, false>();
+
+    // start an encode so the nested streamables' sizes are calculated just once
+    IStreamable::EncodeScope encodeScope(true);
+    WriteStreamableObjects(aStreamable);
+
+    Finish();
+    assert(mSize == aStreamable.FindObjectsSize());
+  }
+
+  /**
+   * @brief Gets the segments
+   * @return the segments
+   */
+  [[nodiscard]] const std::vector<type_segment> & GetSegments() const noexcept
+  {
+    return mSegments;
+  }
+
+  /**
+   * @brief Gets the size in bytes of all the segments
+   * @return the size in bytes of all the segments
+   */
+  [[nodiscard]] size_t GetSize() const noexcept { return mSize; }
+
+private:
+  /**
+   * @brief A segment that isn't finished yet because the owned buffer may be reallocated
+   */
+  struct Segment
+  {
+    const void * mData{};    // the referenced memory or nullptr for the owned buffer
+    size_t       mOffset{};  // the offset in the owned buffer
+    size_t       mSize{};
+  };
+
+  size_t                    mThreshold{};
+  size_t                    mSegmentsMax{};
+  size_t                    mSize{};
+  type_stream               mBuffer{};
+  std::vector<Segment>      mSegmentsPending{};
+  std::vector<type_segment> mSegments{};
+
+  /**
+   * @brief Copies bytes to the owned buffer extending the last segment if it's owned too
+   * @param aData the bytes
+   * @param aSize the number of bytes
+   */
+  void Copy(const void * aData, const size_t aSize)
+  {
+    if (!aSize)
+    {
+      return;
+    }
+
+    if (mSegmentsPending.empty() || mSegmentsPending.back().mData)
+    {
+      mSegmentsPending.push_back({ nullptr, mBuffer.size(), 0 });
+    }
+
+    const auto dataPtr = reinterpret_cast<const type_stream_value *>(aData);
+    mBuffer.insert(mBuffer.end(), dataPtr, dataPtr + aSize);
+    mSegmentsPending.back().mSize += aSize;
+    mSize += aSize;
+  }
+
+  /**
+   * @brief References bytes if they are big enough or copies them otherwise
+   * @note The bytes are copied too if the reference and the owned segment that may follow it
+   * would exceed the maximum number of segments
+   * @param aData the bytes
+   * @param aSize the number of bytes
+   */
+  void Reference(const void * aData, const size_t aSize)
+  {
+    if (aSize < mThreshold || mSegmentsPending.size() + 2 > mSegmentsMax)
+    {
+      Copy(aData, aSize);
+      return;
+    }
+
+    mSegmentsPending.push_back({ aData, {}, aSize });
+    mSize += aSize;
+  }
+
+  /**
+   * @brief Converts the pending segments to segments now that the owned buffer won't change
+   */
+  void Finish()
+  {
+    mSegments.reserve(mSegmentsPending.size());
+    for (const auto & segment : mSegmentsPending)
+    {
+      const auto data = segment.mData ? segment.mData : mBuffer.data() + segment.mOffset;
+      mSegments.push_back({ const_cast<void *>(data), segment.mSize });
+    }
+
+    mSegmentsPending = {};
+  }
+
+  /**
+   * @brief Writes a size to the owned buffer
+   * @param aSize the size
+   */
+  void WriteSize(const type_size_sub_stream aSize) { Copy(&aSize, sizeof(aSize)); }
+
+  /**
+   * @brief Writes the object like IStreamable::Write does
+   * @tparam Type the object's type
+   * @param aObject the object
+   */
+  template <typename Type>
+  void Write(Type & aObject)
+  {
+    StreamableSizeFinder::AssertAccepted<Type>();
+
+    if constexpr (is_basic_string_v<Type>)
+    {
+      const auto size = type_size_sub_stream(aObject.size() * sizeof(typename Type::value_type));
+      WriteSize(size);
+      Reference(aObject.data(), size);
+    }
+    else if constexpr (std::is_same_v<std::remove_cvref_t<Type>, std::filesystem::path>)
+    {
+      // the wide string is a temporary so it must be copied
+      const auto wstr(aObject.wstring());
+      const auto size = type_size_sub_stream(wstr.size() * sizeof(std::wstring::value_type));
+      WriteSize(size);
+      Copy(wstr.data(), size);
+    }
+    else if constexpr (is_known_size_v<Type>)
+    {
+      Reference(&aObject, sizeof(Type));
+    }
+    else if constexpr (std::is_base_of_v<IStreamable, Type>)
+    {
+      WriteSize(type_size_sub_stream(aObject.FindObjectsSize()));
+      WriteStreamableObjects(aObject);
+    }
+    else if constexpr (is_columnar_range_v<Type>)
+    {
+      WriteColumns(aObject);
+    }
+    else if constexpr (is_delta_range_v<Type>)
+    {
+      // the deltas don't exist in the streamable's memory so they must be copied
+      type_stream stream;
+      Type::Encode(aObject, stream);
+      Copy(stream.data(), stream.size());
+    }
+    else if constexpr (std::ranges::range<Type>)
+    {
+      WriteRange(aObject);
+    }
+    else
+    {
+      StreamableSizeFinder::AssertAccepted<Type, false>();
+    }
+  }
+
+  /**
+   * @brief Writes the objects of a streamable without it's leading size
+   * @note Streamables that don't have GetObjects are serialized with ToStream and their stream
+   * is referenced
+   * @tparam Type the streamable's type
+   * @param aStreamable the streamable
+   */
+  template <typename Type>
+  void WriteStreamableObjects(Type & aStreamable)
+  {
+    if constexpr (has_method_get_objects_v<Type>)
+    {
+      std::apply(
+        [this](auto &... aObjects)
+        {
+          (Write(aObjects), ...);
+        },
+        aStreamable.GetObjects());
+    }
+    else
+    {
+      // the stream is kept by the streamable until it's serialized again
+      const auto & stream = static_cast<IStreamable &>(aStreamable).ToStream();
+      Reference(stream.data(), stream.size());
+    }
+  }
+
+  /**
+   * @brief Writes any nested range referencing the contiguous ranges of known size objects
+   * @tparam Range the nested range's type
+   * @param aRange the nested range
+   */
+  template <std::ranges::range Range>
+  void WriteRange(Range & aRange)
+  {
+    using type_value = std::ranges::range_value_t<Range>;
+
+    WriteSize(type_size_sub_stream(std::ranges::size(aRange)));
+    if constexpr (std::ranges::contiguous_range<Range> && is_known_size_v<type_value>)
+    {
+      Reference(std::ranges::data(aRange), std::ranges::size(aRange) * sizeof(type_value));
+    }
+    else
+    {
+      for (auto & object : aRange)
+      {
+        Write(object);
+      }
+    }
+  }
+
+  /**
+   * @brief Writes a columnar range like IStreamable::WriteColumns does
+   * @tparam Range the columnar range's type
+   * @param aRange the columnar range
+   */
+  template <typename Range>
+  void WriteColumns(Range & aRange)
+  {
+    WriteSize(type_size_sub_stream(std::ranges::size(aRange)));
+
+    [&]<size_t... aIndexes>(std::index_sequence<aIndexes...>)
+    {
+      (WriteColumn<aIndexes>(aRange), ...);
+    }(std::make_index_sequence<std::tuple_size_v<typename Range::type_columns>>());
+  }
+
+  /**
+   * @brief Writes a column of a columnar range
+   * @tparam aIndex the column's index in the element's objects
+   * @tparam Range the columnar range's type
+   * @param aRange the columnar range
+   */
+  template <size_t aIndex, typename Range>
+  void WriteColumn(Range & aRange)
+  {
+    const auto columnSize = StreamableSizeFinder::FindColumnSize<aIndex>(aRange);
+    WriteSize(type_size_sub_stream(columnSize - sizeof(type_size_sub_stream)));
+
+    for (auto & row : aRange)
+    {
+      // the known size members are not contiguous so they are always copied
+      if constexpr (is_known_size_v<typename Range::template type_column<aIndex>>)
+      {
+        const auto & object = std::get<aIndex>(row.GetObjects());
+        Copy(&object, sizeof(object));
+      }
+      else
+      {
+        Write(std::get<aIndex>(row.GetObjects()));
+      }
+    }
+  }
+};
+
+/**
+ * @brief Creates and applies patches that contain just the objects that differ between two
+ * snapshots of the same streamable, so replicas can be updated without a full ToStream
+ * @note Format of a streamable: a bit mask with a bit for every object from GetObjects followed
+ * by the patches of the objects that changed in order
+ * @note Format of a range: it's new size + a bit mask with a bit for every element that both
+ * snapshots have + the patches of those elements that changed + the new elements streamed as
+ * usual, the range is truncated if it's new size is smaller
+ * @note The rest of the objects (known size objects, strings, streamables without GetObjects
+ * etc...) are streamed as usual if they changed
+ * @note Ranges that can't be resized (ex.: std::array) are patched just element by element, so
+ * both snapshots should have the same size, otherwise Apply reports that the patch wasn't applied
+ * whole
+ * @note Known size objects are compared with their operator== if they have one or by their bytes
+ * if they don't have padding, otherwise they are always streamed
+ */
+class StreamablePatch
+{
+public:
+  using type_size_sub_stream = IStreamable::type_size_sub_stream;
+  using type_stream          = IStreamable::type_stream;
+  using type_stream_value    = IStreamable::type_stream_value;
+
+  /**
+   * @brief Creates the patch that transforms the old streamable into the new one
+   * @tparam Type the streamable's type that must have GetObjects
+   * @note The snapshots are not modified, just the nested streamables without GetObjects and the
+   * objects that contain them are copied to be compared or written because ToStream is not const
+   * @param aOld the old streamable
+   * @param aNew the new streamable
+   * @return the patch
+   */
+  template <typename Type>
+  static [[nodiscard]] type_stream Create(const Type & aOld, const Type & aNew)
+  {
+    StreamableSizeFinder::AssertStreamable<Type>();
+
+    StreamableBuffer stream;
+    WriteObjectsPatch(stream, aOld, aNew);
+    return stream.ToStream();
+  }
+
+  /**
+   * @brief Applies the patch to the streamable in place
+   * @note The streamable must be equal to the old streamable that the patch was created from
+   * @tparam Type the streamable's type that must have GetObjects
+   * @param aStreamable the streamable
+   * @param aPatch the patch
+   * @return false if a range that can't be resized changed it's size, in which case just it's
+   * elements that both snapshots have were patched and the rest of the patch was applied
+   */
+  template <typename Type>
+  static bool Apply(Type & aStreamable, type_stream && aPatch)
+  {
+    StreamableSizeFinder::AssertStreamable<Type>();
+
+    StreamableBuffer stream(move(aPatch));
+    const auto       applied = ReadObjectsPatch(stream, aStreamable);
+    assert(stream.mIndex == stream.mStream.size());
+
+    return applied;
+  }
+
+private:
+  /**
+   * @brief Checks if two objects are equal
+   * @note Streamables that don't have GetObjects are compared by their streams
+   * @tparam Type the objects' type
+   * @param aLeft the left object
+   * @param aRight the right object
+   * @return true if the objects are equal
+   */
+  template <typename Type>
+  static [[nodiscard]] bool IsEqual(const Type & aLeft, const Type & aRight)
+  {
+    if constexpr (is_basic_string_v<Type> || is_bool_vector_v<Type> ||
+                  std::is_same_v<std::remove_cvref_t<Type>, std::filesystem::path>)
+    {
+      return aLeft == aRight;
+    }
+    else if constexpr (is_known_size_v<Type> && std::is_array_v<Type>)
+    {
+      return std::ranges::equal(aLeft, aRight,
+                                [](const auto & aObjectLeft, const auto & aObjectRight)
+                                {
+                                  return IsEqual(aObjectLeft, aObjectRight);
+                                });
+    }
+    else if constexpr (is_known_size_v<Type> && std::equality_comparable<Type>)
+    {
+      return aLeft == aRight;
+    }
+    else if constexpr (is_known_size_v<Type>)
+    {
+      // the bytes of padding may differ between equal objects so they are always streamed
+      if constexpr (std::has_unique_object_representations_v<Type>)
+      {
+        return !std::memcmp(&aLeft, &aRight, sizeof(Type));
+      }
+      else
+      {
+        return false;
+      }
+    }
+    else if constexpr (std::is_base_of_v<IStreamable, Type> && has_method_get_objects_v<Type>)
+    {
+      auto objectsLeft  = aLeft.GetObjects();
+      auto objectsRight = aRight.GetObjects();
+
+      return [&]<size_t... aIndexes>(std::index_sequence<aIndexes...>)
+      {
+        return (IsEqual(std::get<aIndexes>(objectsLeft), std::get<aIndexes>(objectsRight)) && ...);
+      }(std::make_index_sequence<std::tuple_size_v<decltype(objectsLeft)>>());
+    }
+    else if constexpr (std::is_base_of_v<IStreamable, Type>)
+    {
+      Type left(aLeft), right(aRight);
+      return left.ToStream() == right.ToStream();
+    }
+    else if constexpr (std::ranges::range<Type>)
+    {
+      return std::ranges::equal(aLeft, aRight,
+                                [](const auto & aObjectLeft, const auto & aObjectRight)
+                                {
+                                  return IsEqual(aObjectLeft, aObjectRight);
+                                });
+    }
+    else
+    {
+      StreamableSizeFinder::AssertAccepted<Type, false>();
     }
   }
 
   /**
-   * @brief Writes the object in the stream
+   * @brief Writes the patch of an object that changed
+   * @tparam Type the object's type
+   * @param aStream the patch's stream
+   * @param aOld the old object
+   * @param aNew the new object
+   */
+  template <typename Type>
+  static void WritePatch(IStreamable & aStream, const Type & aOld, const Type & aNew)
+  {
+    if constexpr (std::is_base_of_v<IStreamable, Type> && has_method_get_objects_v<Type>)
+    {
+      WriteObjectsPatch(aStream, aOld, aNew);
+    }
+    else if constexpr (is_patchable_range_v<Type>)
+    {
+      WriteRangePatch(aStream, aOld, aNew);
+    }
+    else
+    {
+      Write(aStream, aNew);
+    }
+  }
+
+  /**
+   * @brief Writes an object as usual
+   * @note Objects that may contain streamables are copied because ToStream is not const
    * @tparam Type the object's type
+   * @param aStream the patch's stream
    * @param aObject the object
-   * @param aSize the object's size in bytes
-   * @note aSize is required for unhandled types
    */
-  template <typename Type = void *>
-  constexpr void Write(Type & aObject, const type_size_sub_stream aSize = 0)
+  template <typename Type>
+  static void Write(IStreamable & aStream, const Type & aObject)
   {
-    static_assert(is_accepted_v<Type>, "The object's type is not accepted!");
+    if constexpr (IsWritableConst<Type>())
+    {
+      aStream.Write(aObject);
+    }
+    else
+    {
+      Type object(aObject);
+      aStream.Write(object);
+    }
+  }
 
-    if constexpr (is_basic_string_v<Type>)
+  /**
+   * @brief Checks if an object can be written without modifying it
+   * @tparam Type the object's type
+   * @return true if the object doesn't contain any streamable
+   */
+  template <typename Type>
+  static [[nodiscard]] constexpr bool IsWritableConst() noexcept
+  {
+    if constexpr (is_basic_string_v<Type> || is_bool_vector_v<Type> || is_known_size_v<Type> ||
+                  is_delta_range_v<Type> ||
+                  std::is_same_v<std::remove_cvref_t<Type>, std::filesystem::path>)
     {
-      auto size = type_size_sub_stream(aObject.size() * sizeof(Type::value_type));
-      WriteObject(aObject.data(), size);
+      return true;
     }
-    else if constexpr (std::is_same_v<std::remove_cvref_t<Type>, std::filesystem::path>)
+    else if constexpr (std::is_base_of_v<IStreamable, Type> || is_columnar_range_v<Type>)
     {
-      const auto wstr(aObject.wstring());
-      Write(wstr);
+      return false;
     }
-    else if constexpr (std::is_standard_layout_v<Type>)
+    else if constexpr (std::ranges::range<Type>)
     {
-      WriteObjectOfKnownSize(&aObject, sizeof(Type));
+      return IsWritableConst<std::ranges::range_value_t<Type>>();
     }
-    else if constexpr (std::is_base_of_v<IStreamable, Type>)
+    else
+    {
+      return false;
+    }
+  }
+
+  /**
+   * @brief Writes the bit mask of the objects that changed followed by their patches
+   * @tparam Type the streamable's type
+   * @param aStream the patch's stream
+   * @param aOld the old streamable
+   * @param aNew the new streamable
+   */
+  template <typename Type>
+  static void WriteObjectsPatch(IStreamable & aStream, const Type & aOld, const Type & aNew)
+  {
+    auto objectsOld = aOld.GetObjects();
+    auto objectsNew = aNew.GetObjects();
+
+    constexpr auto objectsCount = std::tuple_size_v<decltype(objectsNew)>;
+    std::array<type_stream_value, (objectsCount + 7) / 8> mask{};
+
+    [&]<size_t... aIndexes>(std::index_sequence<aIndexes...>)
+    {
+      ((mask[aIndexes / 8] |=
+        type_stream_value(!IsEqual(std::get<aIndexes>(objectsOld), std::get<aIndexes>(objectsNew))
+                          << aIndexes % 8)),
+       ...);
+      aStream.WriteObjectOfKnownSize(mask);
+
+      ((mask[aIndexes / 8] >> aIndexes % 8 & 1
+          ? WritePatch(aStream, std::get<aIndexes>(objectsOld), std::get<aIndexes>(objectsNew))
+          : void()),
+       ...);
+    }(std::make_index_sequence<objectsCount>());
+  }
+
+  /**
+   * @brief Writes the patch of a range
+   * @tparam Range the range's type
+   * @param aStream the patch's stream
+   * @param aOld the old range
+   * @param aNew the new range
+   */
+  template <typename Range>
+  static void WriteRangePatch(IStreamable & aStream, const Range & aOld, const Range & aNew)
+  {
+    const auto sizeNew    = std::ranges::size(aNew);
+    const auto sizeCommon = std::min<size_t>(std::ranges::size(aOld), sizeNew);
+    aStream.WriteSize(type_size_sub_stream(sizeNew));
+
+    type_stream mask((sizeCommon + 7) / 8);
+    auto        objectOld = std::ranges::begin(aOld);
+    auto        objectNew = std::ranges::begin(aNew);
+    for (size_t i = 0; i < sizeCommon; i++, ++objectOld, ++objectNew)
+    {
+      mask[i / 8] |= type_stream_value(!IsEqual(*objectOld, *objectNew) << i % 8);
+    }
+    aStream.WriteBytes(mask.data(), mask.size());
+
+    objectOld = std::ranges::begin(aOld);
+    objectNew = std::ranges::begin(aNew);
+    for (size_t i = 0; i < sizeCommon; i++, ++objectOld, ++objectNew)
+    {
+      if (mask[i / 8] >> i % 8 & 1)
+      {
+        WritePatch(aStream, *objectOld, *objectNew);
+      }
+    }
+
+    for (; objectNew != std::ranges::end(aNew); ++objectNew)
+    {
+      Write(aStream, *objectNew);
+    }
+  }
+
+  /**
+   * @brief Reads the patch of an object and applies it
+   * @tparam Type the object's type
+   * @param aStream the patch's stream
+   * @param aObject the object
+   * @return false if the patch wasn't applied whole (see Apply)
+   */
+  template <typename Type>
+  static bool ReadPatch(IStreamable & aStream, Type & aObject)
+  {
+    if constexpr (std::is_base_of_v<IStreamable, Type> && has_method_get_objects_v<Type>)
+    {
+      return ReadObjectsPatch(aStream, aObject);
+    }
+    else if constexpr (is_patchable_range_v<Type>)
+    {
+      return ReadRangePatch(aStream, aObject);
+    }
+    else
+    {
+      aObject = aStream.Read<Type>();
+      return true;
+    }
+  }
+
+  /**
+   * @brief Reads the bit mask of the objects that changed and applies their patches
+   * @tparam Type the streamable's type
+   * @param aStream the patch's stream
+   * @param aStreamable the streamable
+   * @return false if the patch wasn't applied whole (see Apply)
+   */
+  template <typename Type>
+  static bool ReadObjectsPatch(IStreamable & aStream, Type & aStreamable)
+  {
+    auto objects = aStreamable.GetObjects();
+
+    constexpr auto objectsCount = std::tuple_size_v<decltype(objects)>;
+    using type_mask             = std::array<type_stream_value, (objectsCount + 7) / 8>;
+    const type_mask mask        = aStream.ReadObjectOfKnownSize<type_mask>();
+
+    bool applied = true;
+    [&]<size_t... aIndexes>(std::index_sequence<aIndexes...>)
+    {
+      ((mask[aIndexes / 8] >> aIndexes % 8 & 1
+          ? void(applied &= ReadPatch(aStream, std::get<aIndexes>(objects)))
+          : void()),
+       ...);
+    }(std::make_index_sequence<objectsCount>());
+
+    return applied;
+  }
+
+  /**
+   * @brief Reads the patch of a range and applies it
+   * @tparam Range the range's type
+   * @param aStream the patch's stream
+   * @param aRange the range
+   * @return false if the patch wasn't applied whole (see Apply)
+   */
+  template <typename Range>
+  static bool ReadRangePatch(IStreamable & aStream, Range & aRange)
+  {
+    const size_t sizeNew    = aStream.ReadSize();
+    const auto   sizeCommon = std::min<size_t>(std::ranges::size(aRange), sizeNew);
+
+    // the stream is not modified while the patch is read so the mask can be used in place
+    const auto mask = aStream.mStream.data() + aStream.mIndex;
+    aStream.mIndex += (sizeCommon + 7) / 8;
+
+    bool applied = true;
+    auto object  = std::ranges::begin(aRange);
+    for (size_t i = 0; i < sizeCommon; i++, ++object)
+    {
+      if (mask[i / 8] >> i % 8 & 1)
+      {
+        applied &= ReadPatch(aStream, *object);
+      }
+    }
+
+    if constexpr (is_resizable_range_v<Range>)
+    {
+      aRange.erase(object, std::ranges::end(aRange));
+      if constexpr (has_method_reserve_v<Range>)
+      {
+        aRange.reserve(sizeNew);
+      }
+
+      for (size_t i = sizeCommon; i < sizeNew; i++)
+      {
+        aRange.insert(std::ranges::cend(aRange), aStream.Read<typename Range::value_type>());
+      }
+
+      return applied;
+    }
+    else
+    {
+      // the fixed size ranges are patched just in place, the elements that don't fit are read
+      // so the rest of the patch is still applied
+      for (size_t i = sizeCommon; i < sizeNew; i++)
+      {
+        [[maybe_unused]] const auto element = aStream.Read<typename Range::value_type>();
+      }
+
+      return applied && sizeNew == std::ranges::size(aRange);
+    }
+  }
+};
+
+/**
+ * @brief Finds, reads and writes the objects of a streamable directly inside it's stream
+ * @note The objects can be read without deserializing the whole streamable, one by one or just a
+ * selection of them
+ * @note The offset of an object is found by skipping the objects before it: known size objects
+ * are skipped at compile time, strings, nested streamables and delta ranges by their leading size
+ * and the rest of the ranges element by element
+ * @note ex.: StreamableAccessor<Message>::WriteObject<2>(stream, Status::Done) changes just the
+ * bytes of the third object without deserializing the message
+ * @tparam Type the streamable's type that must be defined with one of the ISTREAMABLE_DEFINE_X
+ * macros
+ */
+template <typename Type>
+class StreamableAccessor
+{
+public:
+  using type_stream = std::span<const uint8_t>;
+  using type_size   = StreamableSizeFinder::type_size_sub_stream;
+  using type_objects =
+    std::remove_cvref_t<decltype(std::declval<const Type &>().GetObjects())>;
+
+  template <size_t aIndex>
+  using type_object = std::remove_cvref_t<std::tuple_element_t<aIndex, type_objects>>;
+
+  /**
+   * @brief Finds the offset of an object inside the streamable's stream
+   * @tparam aIndex the object's index in the streamable's objects
+   * @param aStream the streamable's stream
+   * @return the offset of the object's first byte
+   */
+  template <size_t aIndex>
+  static [[nodiscard]] size_t FindObjectOffset(type_stream aStream) noexcept
+  {
+    static_assert(aIndex < std::tuple_size_v<type_objects>, "The object doesn't exist!");
+
+    size_t offset{};
+    [&]<size_t... aIndexes>(std::index_sequence<aIndexes...>)
+    {
+      ((offset += FindObjectSize<type_object<aIndexes>>(aStream, offset)), ...);
+    }(std::make_index_sequence<aIndex>());
+
+    return offset;
+  }
+
+  /**
+   * @brief Reads just an object from the streamable's stream
+   * @tparam aIndex the object's index in the streamable's objects
+   * @param aStream the streamable's stream
+   * @return the object
+   */
+  template <size_t aIndex>
+  static [[nodiscard]] type_object<aIndex> ReadObject(type_stream aStream)
+  {
+    size_t size{};
+    return ReadObjectAt<type_object<aIndex>>(aStream, FindObjectOffset<aIndex>(aStream), size);
+  }
+
+  /**
+   * @brief Reads just the selected objects from the streamable's stream in a single pass
+   * @note The objects that are not selected are skipped without being decoded and the ones after
+   * the last selected object are not even skipped
+   * @note ex.: StreamableAccessor<Message>::ReadObjects<0, 2>(stream, message) reads just the
+   * first and the third object of the message
+   * @tparam ...aIndexes the objects' indexes in the streamable's objects
+   * @param aStream the streamable's stream
+   * @param aStreamable the streamable to read the objects to
+   */
+  template <size_t... aIndexes>
+  static void ReadObjects(type_stream aStream, Type & aStreamable)
+  {
+    static_assert(sizeof...(aIndexes), "No object is selected!");
+    static_assert(((aIndexes < std::tuple_size_v<type_objects>) && ...),
+                  "The object doesn't exist!");
+
+    auto   objects = aStreamable.GetObjects();
+    size_t offset{};
+    [&]<size_t... aIndexesAll>(std::index_sequence<aIndexesAll...>)
+    {
+      (ReadObjectIfSelected<aIndexesAll, aIndexes...>(aStream, offset, objects), ...);
+    }(std::make_index_sequence<std::max({ aIndexes... }) + 1>());
+  }
+
+  /**
+   * @brief Overwrites a known size object directly in the streamable's stream
+   * @tparam aIndex the object's index in the streamable's objects
+   * @param aStream the streamable's stream
+   * @param aObject the new object
+   */
+  template <size_t aIndex>
+  static void WriteObject(std::span<uint8_t> aStream, const type_object<aIndex> & aObject) noexcept
+  {
+    static_assert(is_known_size_v<type_object<aIndex>>,
+                  "Only known size objects can be written directly!");
+
+    std::memcpy(aStream.data() + FindObjectOffset<aIndex>(aStream), &aObject, sizeof(aObject));
+  }
+
+private:
+  /**
+   * @brief Reads the object if it's selected and skips it
+   * @tparam aIndex the object's index in the streamable's objects
+   * @tparam ...aIndexes the selected objects' indexes
+   * @tparam Objects the streamable's objects' type
+   * @param aStream the streamable's stream
+   * @param aOffset the object's offset that is moved after the object
+   * @param aObjects the streamable's objects
+   */
+  template <size_t aIndex, size_t... aIndexes, typename Objects>
+  static void ReadObjectIfSelected(type_stream aStream, size_t & aOffset, Objects & aObjects)
+  {
+    if constexpr (((aIndex == aIndexes) || ...))
+    {
+      size_t size{};
+      std::get<aIndex>(aObjects) = ReadObjectAt<type_object<aIndex>>(aStream, aOffset, size);
+      aOffset += size;
+    }
+    else
+    {
+      aOffset += FindObjectSize<type_object<aIndex>>(aStream, aOffset);
+    }
+  }
+
+  /**
+   * @brief Reads an object from a stream
+   * @note Known size objects and strings are read directly from the stream while the rest of the
+   * objects' bytes are copied to a buffer and read like IStreamable reads them
+   * @tparam Object the object's type
+   * @param aStream the stream
+   * @param aIndex the object's position in the stream
+   * @param aSize the object's size in bytes including it's leading size, found while it's read
+   * @return the object
+   */
+  template <typename Object>
+  static [[nodiscard]] Object ReadObjectAt(type_stream aStream, const size_t aIndex,
+                                           size_t & aSize)
+  {
+    if constexpr (is_basic_string_v<Object>)
+    {
+      using type_value = typename Object::value_type;
+
+      const auto size      = StreamableSizeFinder::ReadSize(aStream, aIndex);
+      const auto stringPtr = reinterpret_cast<const type_value *>(aStream.data() + aIndex +
+                                                                   sizeof(type_size));
+      aSize = sizeof(type_size) + size;
+      return Object(stringPtr, size / sizeof(type_value));
+    }
+    else if constexpr (is_known_size_v<Object>)
+    {
+      Object object{};
+      std::memcpy(&object, aStream.data() + aIndex, sizeof(object));
+      aSize = sizeof(object);
+      return object;
+    }
+    else
+    {
+      aSize = FindObjectSize<Object>(aStream, aIndex);
+
+      const auto       objectPtr = aStream.data() + aIndex;
+      StreamableBuffer buffer({ objectPtr, objectPtr + aSize });
+      return buffer.Read<Object>();
+    }
+  }
+
+  /**
+   * @brief Finds the size in bytes of an object inside a stream
+   * @tparam Object the object's type
+   * @param aStream the stream
+   * @param aIndex the object's position in the stream
+   * @return the object's size in bytes including it's leading size
+   */
+  template <typename Object>
+  static [[nodiscard]] size_t FindObjectSize(type_stream aStream, const size_t aIndex) noexcept
+  {
+    if constexpr (is_basic_string_v<Object> ||
+                  std::is_same_v<std::remove_cvref_t<Object>, std::filesystem::path>)
+    {
+      return sizeof(type_size) + StreamableSizeFinder::ReadSize(aStream, aIndex);
+    }
+    else if constexpr (is_known_size_v<Object>)
+    {
+      return sizeof(Object);
+    }
+    else if constexpr (std::is_base_of_v<IStreamable, Object>)
+    {
+      return sizeof(type_size) + StreamableSizeFinder::ReadSize(aStream, aIndex);
+    }
+    else if constexpr (is_columnar_range_v<Object>)
+    {
+      auto index = aIndex + sizeof(type_size);
+      for (size_t column = 0; column < std::tuple_size_v<typename Object::type_columns>; column++)
+      {
+        index += sizeof(type_size) + StreamableSizeFinder::ReadSize(aStream, index);
+      }
+
+      return index - aIndex;
+    }
+    else if constexpr (is_delta_range_v<Object>)
+    {
+      return sizeof(type_size) * 2 +
+             StreamableSizeFinder::ReadSize(aStream, aIndex + sizeof(type_size));
+    }
+    else if constexpr (std::ranges::range<Object>)
+    {
+      using type_value = std::ranges::range_value_t<Object>;
+
+      const auto count = StreamableSizeFinder::ReadSize(aStream, aIndex);
+      if constexpr (is_known_size_v<type_value>)
+      {
+        return sizeof(type_size) + count * sizeof(type_value);
+      }
+      else
+      {
+        auto index = aIndex + sizeof(type_size);
+        for (size_t i = 0; i < count; i++)
+        {
+          index += FindObjectSize<type_value>(aStream, index);
+        }
+
+        return index - aIndex;
+      }
+    }
+    else
+    {
+      StreamableSizeFinder::AssertAccepted<Object, false>();
+    }
+  }
+};
+
+/**
+ * @brief Serializes streamables in an aligned layout whose objects can be accessed directly in
+ * the stream without decoding it (like FlatBuffers), so the messages are a bit bigger but the
+ * reads cost just aligned loads
+ * @note Format of a streamable: a header with the offsets of the variable size objects, followed
+ * by the known size objects, each aligned to it's natural alignment, followed by the variable
+ * size objects, the header and the known size objects are at offsets known at compile time
+ * @note Format of the variable size objects:
+ * - strings and ranges of known size objects: their elements count followed by the elements
+ * aligned to their natural alignment
+ * - nested streamables with GetObjects: the format of a streamable aligned to kAlignment
+ * - the rest of the ranges: their elements count, the offsets of the elements from the range's
+ * start and the elements in the format of the variable size objects
+ * - the rest of the objects (streamables without GetObjects, columnar ranges, delta ranges...):
+ * their size in bytes followed by the bytes written by IStreamable
+ * @note The stream must start at an address aligned to kAlignment (ex.: a vector's data)
+ */
+class StreamableAligned
+{
+public:
+  using type_size_sub_stream = IStreamable::type_size_sub_stream;
+  using type_stream          = IStreamable::type_stream;
+  using type_stream_value    = IStreamable::type_stream_value;
+
+  static constexpr size_t kAlignment = alignof(std::max_align_t);
+
+  template <typename Type>
+  using type_objects = std::remove_cvref_t<decltype(std::declval<const Type &>().GetObjects())>;
+
+  template <typename Type, size_t aIndex>
+  using type_object = std::remove_cvref_t<std::tuple_element_t<aIndex, type_objects<Type>>>;
+
+  template <typename Range>
+  class RangeView;
+
+  /**
+   * @brief Accesses the objects of a streamable directly in it's aligned stream
+   * @note ex.: StreamableAligned::View<Message> view(stream); view.Get<1>() returns the second
+   * object of the message without decoding the stream
+   * @tparam Type the streamable's type that must be defined with one of the ISTREAMABLE_DEFINE_X
+   * macros
+   */
+  template <typename Type>
+  class View
+  {
+  public:
+    /**
+     * @brief Views the streamable
+     * @param aStream the streamable's aligned stream
+     */
+    explicit View(std::span<const type_stream_value> aStream) noexcept
+      : mStream(aStream.data())
+    {
+      assert(IsAligned(mStream, kAlignment) && aStream.size() >= kLayout<Type>.mSize);
+    }
+
+    /**
+     * @brief Gets an object directly from the stream
+     * @tparam aIndex the object's index in the streamable's objects
+     * @return a reference to a known size object, a string view to a string or a path, a span
+     * to a range of known size objects, a view to a nested streamable or to a range and a span
+     * to the bytes of the rest of the objects
+     */
+    template <size_t aIndex>
+    [[nodiscard]] decltype(auto) Get() const noexcept
     {
-      WriteStreamable(aObject);
+      using type_object = StreamableAligned::type_object<Type, aIndex>;
+
+      constexpr auto offset = kLayout<Type>.mOffsets[aIndex];
+      if constexpr (is_known_size_v<type_object>)
+      {
+        return Load<type_object>(mStream + offset);
+      }
+      else
+      {
+        return ViewObject<type_object>(mStream + Load<type_size_sub_stream>(mStream + offset));
+      }
     }
-    // last check because types like string and path are ranges
-    else if constexpr (std::ranges::range<Type>)
+
+  private:
+    const type_stream_value * mStream{};
+  };
+
+  /**
+   * @brief Accesses the elements of a range that don't have a known size directly in the stream
+   * @tparam Range the range's type
+   */
+  template <typename Range>
+  class RangeView
+  {
+  public:
+    /**
+     * @brief Views the range
+     * @param aRange the range's first byte
+     */
+    explicit RangeView(const type_stream_value * aRange) noexcept
+      : mRange(aRange)
     {
-      WriteRange(aObject);
     }
-    else
+
+    [[nodiscard]] size_t size() const noexcept { return Load<type_size_sub_stream>(mRange); }
+
+    /**
+     * @brief Gets an element directly from the stream
+     * @param aIndex the element's index
+     * @return the element's view like the ones returned by View::Get
+     */
+    [[nodiscard]] decltype(auto) operator[](const size_t aIndex) const noexcept
     {
-      WriteObject(&aObject, aSize);
+      const auto offset = mRange + sizeof(type_size_sub_stream) * (aIndex + 1);
+      return ViewObject<std::ranges::range_value_t<Range>>(mRange +
+                                                            Load<type_size_sub_stream>(offset));
     }
-  }
+
+  private:
+    const type_stream_value * mRange{};
+  };
 
   /**
-   * @brief Writes a number of bytes from stream
-   * @param aStream the stream
-   * @param aSize the number of bytes to write
+   * @brief Serializes the streamable in the aligned layout
+   * @tparam Type the streamable's type that must be defined with one of the ISTREAMABLE_DEFINE_X
+   * macros
+   * @param aStreamable the streamable
+   * @return the aligned stream
    */
-  void WriteObject(const void * aStream, const type_size_sub_stream aSize)
+  template <typename Type>
+  static [[nodiscard]] type_stream ToStream(Type & aStreamable)
   {
-    WriteSize(aSize);
+    StreamableSizeFinder::AssertStreamable<Type>();
 
-    // write the stream
-    const auto streamPtr = reinterpret_cast<const type_stream_value *>(aStream);
-    mStream.insert(mStream.end(), streamPtr, streamPtr + aSize);
-    mIndex += aSize;
+    type_stream stream;
+    WriteStreamable(stream, aStreamable);
+    return stream;
   }
 
   /**
-   * @brief Writes an object that directly implements IStreamable
-   * @param aStreamable the IStreamable object
+   * @brief Deserializes all the objects of the streamable from it's aligned stream
+   * @tparam Type the streamable's type that must be defined with one of the ISTREAMABLE_DEFINE_X
+   * macros
+   * @param aStream the aligned stream
+   * @param aStreamable the streamable to read the objects to
    */
-  void WriteStreamable(IStreamable & aStreamable)
+  template <typename Type>
+  static void Read(std::span<const type_stream_value> aStream, Type & aStreamable)
   {
-    const auto streamableSize = aStreamable.GetObjectsSize();
-    WriteSize(type_size_sub_stream(streamableSize));
-    auto stream(aStreamable.ToStream());
+    StreamableSizeFinder::AssertStreamable<Type>();
+    assert(IsAligned(aStream.data(), kAlignment) && aStream.size() >= kLayout<Type>.mSize);
 
-    // write the streamable
-    mStream.insert(mStream.end(), stream.cbegin(), stream.cend());
-    mIndex += streamableSize;
+    ReadStreamable(aStream.data(), aStreamable);
   }
 
+private:
   /**
-   * @brief Writes a number of bytes from stream
-   * @note the object's type must be a known size type
-   * @param aStream the stream
-   * @param aSize the number of bytes to write
+   * @brief The offsets of the objects of a streamable that are known at compile time: the
+   * header's offsets for the variable size objects and the objects themselves for the known size
+   * objects
    */
-  void WriteObjectOfKnownSize(const void * aStream, const type_size_sub_stream aSize)
+  template <size_t aCount>
+  struct Layout
   {
-    assert(aSize);
+    std::array<size_t, aCount> mOffsets{};
+    size_t                     mSize{};  // the size of the header and the known size objects
+  };
 
-    const auto streamPtr = reinterpret_cast<const type_stream_value *>(aStream);
-    mStream.insert(mStream.end(), streamPtr, streamPtr + aSize);
-    mIndex += aSize;
+  /**
+   * @brief Finds the layout of a streamable
+   * @tparam Type the streamable's type
+   * @return the layout
+   */
+  template <typename Type>
+  static constexpr auto FindLayout()
+  {
+    constexpr auto objectsCount = std::tuple_size_v<type_objects<Type>>;
+
+    Layout<objectsCount> layout{};
+    [&]<size_t... aIndexes>(std::index_sequence<aIndexes...>)
+    {
+      // the header first so it's offsets are aligned too
+      ((!is_known_size_v<type_object<Type, aIndexes>>
+          ? void((layout.mOffsets[aIndexes] = layout.mSize,
+                  layout.mSize += sizeof(type_size_sub_stream)))
+          : void()),
+       ...);
+
+      (AddKnownSizeObject<type_object<Type, aIndexes>>(layout.mOffsets[aIndexes], layout.mSize),
+       ...);
+    }(std::make_index_sequence<objectsCount>());
+
+    return layout;
   }
 
+  template <typename Type>
+  static constexpr auto kLayout = FindLayout<Type>();
+
   /**
-   * @brief Writes any nested range to the stream
-   * @tparam Type the nested range object type
+   * @brief Adds the object after the known size objects if it has a known size
+   * @tparam Object the object's type
+   * @param aOffset the object's offset
+   * @param aSize the size of the header and the known size objects added before it
    */
-  template <std::ranges::range Range>
-  constexpr void WriteRange(const Range & aRange)
+  template <typename Object>
+  static constexpr void AddKnownSizeObject(size_t & aOffset, size_t & aSize)
   {
-    WriteSize(type_size_sub_stream(std::ranges::size(aRange)));
-    if constexpr (!is_accepted_no_range_v<Range> &&
-                  StreamableSizeFinder::FindRangeLayersCount<Range>() > 1)
+    if constexpr (is_known_size_v<Object>)
     {
-      std::ranges::for_each(aRange,
-                            [this](const auto & aObject)
-                            {
-                              WriteRange(aObject);
-                            });
-    }
-    else
-    {
-      std::ranges::for_each(aRange,
-                            [this](const auto & aObject)
-                            {
-                              Write(aObject);
-                            });
+      static_assert(alignof(Object) <= kAlignment, "The object's alignment is too big!");
+
+      aOffset = AlignUp(aSize, alignof(Object));
+      aSize   = aOffset + sizeof(Object);
     }
   }
 
-#pragma endregion
+  static [[nodiscard]] constexpr size_t AlignUp(const size_t aIndex,
+                                                const size_t aAlignment) noexcept
+  {
+    return (aIndex + aAlignment - 1) / aAlignment * aAlignment;
+  }
+
+  static [[nodiscard]] bool IsAligned(const type_stream_value * aPointer,
+                                      const size_t              aAlignment) noexcept
+  {
+    return !(reinterpret_cast<uintptr_t>(aPointer) % aAlignment);
+  }
 
-#pragma region ReadX
   /**
-   * @brief Reads the size of the current sub stream inside the stream
-   * @return the current sub stream size
+   * @brief Aligns a pointer in the stream
+   * @param aPointer the pointer
+   * @param aAlignment the alignment
+   * @return the first aligned pointer that is not before the pointer
    */
-  [[nodiscard]] decltype(auto) ReadSize() noexcept
+  static [[nodiscard]] const type_stream_value * Align(const type_stream_value * aPointer,
+                                                      const size_t              aAlignment) noexcept
   {
-    const auto sizePtr = reinterpret_cast<type_size_sub_stream *>(mStream.data() + mIndex);
-    mIndex += sizeof(type_size_sub_stream);
-    return *sizePtr;
+    const auto address = reinterpret_cast<uintptr_t>(aPointer);
+    return aPointer + (AlignUp(address, aAlignment) - address);
   }
 
   /**
-   * @brief Reads the object from the stream
-   * @note for unhandled object types will return a span
-   * @tparam Type the object's type
-   * @return the object
+   * @brief Loads an object from an aligned position in the stream
+   * @tparam Object the object's type that must be a known size type
+   * @param aPointer the object's position
+   * @return a reference to the object
    */
-  template <typename Type = std::span<type_stream_value>>
-  [[nodiscard]] constexpr decltype(auto) Read()
+  template <typename Object>
+  static [[nodiscard]] const Object & Load(const type_stream_value * aPointer) noexcept
+  {
+    assert(IsAligned(aPointer, alignof(Object)));
+    return *std::launder(reinterpret_cast<const Object *>(aPointer));
+  }
+
+#pragma region Write
+  /**
+   * @brief Grows the stream by a number of bytes that start at an aligned index
+   * @param aStream the stream
+   * @param aAlignment the alignment
+   * @param aSize the number of bytes
+   * @return the aligned index
+   */
+  static size_t Grow(type_stream & aStream, const size_t aAlignment, const size_t aSize)
   {
-    static_assert(is_accepted_v<Type>, "The object's type is not accepted!");
+    const auto index = AlignUp(aStream.size(), aAlignment);
+    aStream.resize(index + aSize);
+    return index;
+  }
 
-    if constexpr (is_basic_string_v<Type>)
+  /**
+   * @brief Writes a streamable aligned to kAlignment
+   * @tparam Type the streamable's type
+   * @param aStream the stream
+   * @param aStreamable the streamable
+   * @return the streamable's index in the stream
+   */
+  template <typename Type>
+  static size_t WriteStreamable(type_stream & aStream, Type & aStreamable)
+  {
+    const auto index   = Grow(aStream, kAlignment, kLayout<Type>.mSize);
+    auto       objects = aStreamable.GetObjects();
+
+    [&]<size_t... aIndexes>(std::index_sequence<aIndexes...>)
     {
-      const auto [ptr, size] = ReadStream<Type>();
-      return Type(ptr, size);
+      (WriteMember(aStream, index + kLayout<Type>.mOffsets[aIndexes], std::get<aIndexes>(objects),
+                   index),
+       ...);
+    }(std::make_index_sequence<std::tuple_size_v<decltype(objects)>>());
+
+    return index;
+  }
+
+  /**
+   * @brief Writes an object of a streamable, the variable size objects are written at the
+   * stream's end and their offset is written to the header
+   * @tparam Object the object's type
+   * @param aStream the stream
+   * @param aIndex the object's index or it's offset's index in the header
+   * @param aObject the object
+   * @param aStreamableIndex the streamable's index in the stream
+   */
+  template <typename Object>
+  static void WriteMember(type_stream & aStream, const size_t aIndex, Object & aObject,
+                          const size_t aStreamableIndex)
+  {
+    if constexpr (is_known_size_v<Object>)
+    {
+      std::memcpy(aStream.data() + aIndex, &aObject, sizeof(aObject));
     }
-    else if constexpr (std::is_same_v<std::remove_cvref_t<Type>, std::filesystem::path>)
+    else
     {
-      const auto [ptr, size] = ReadStream<Type>();
-      return basic_string<std::filesystem::path::value_type>(ptr, size);
+      const auto index = WriteObject(aStream, aObject);
+      StreamableSizeFinder::WriteSize(aStream, aIndex, index - aStreamableIndex);
     }
-    // std::is_standard_layout_v is true for span but we want the last branch for spans so:
-    else if constexpr (std::is_standard_layout_v<Type> &&
-                       !std::is_same_v<Type, std::span<type_stream_value>>)
+  }
+
+  /**
+   * @brief Writes a variable size object at the stream's end
+   * @tparam Object the object's type
+   * @param aStream the stream
+   * @param aObject the object
+   * @return the object's index in the stream
+   */
+  template <typename Object>
+  static size_t WriteObject(type_stream & aStream, Object & aObject)
+  {
+    if constexpr (is_basic_string_v<Object>)
     {
-      return ReadObjectOfKnownSize<Type>();
+      return WriteElements(aStream, aObject);
     }
-    else if constexpr (std::is_base_of_v<IStreamable, Type>)
+    else if constexpr (std::is_same_v<std::remove_cvref_t<Object>, std::filesystem::path>)
     {
-      return ReadStreamable<Type>();
+      return WriteElements(aStream, aObject.wstring());
     }
-    // last check because types like string and path are ranges
-    else if constexpr (std::ranges::range<Type>)
+    else if constexpr (std::is_base_of_v<IStreamable, Object> && has_method_get_objects_v<Object>)
     {
-      return ReadRange<Type>();
+      return WriteStreamable(aStream, aObject);
+    }
+    else if constexpr (std::ranges::range<Object> && !is_accepted_no_range_v<Object>)
+    {
+      if constexpr (is_known_size_v<std::ranges::range_value_t<Object>>)
+      {
+        return WriteElements(aStream, aObject);
+      }
+      else
+      {
+        return WriteRange(aStream, aObject);
+      }
     }
     else
     {
-      return ReadObject();
+      StreamableBuffer buffer;
+      buffer.Write(aObject);
+
+      const auto index = Grow(aStream, sizeof(type_size_sub_stream),
+                              sizeof(type_size_sub_stream) + buffer.mStream.size());
+      StreamableSizeFinder::WriteSize(aStream, index, buffer.mStream.size());
+      std::ranges::copy(buffer.mStream, aStream.begin() + index + sizeof(type_size_sub_stream));
+      return index;
     }
   }
 
   /**
-   * @brief Reads an object that directly implements IStreamable
-   * @tparam Type object's type that directly implements IStreamable
-   * @return the IStreamable object
+   * @brief Writes the elements count of a range of known size objects followed by the elements
+   * @tparam Range the range's type
+   * @param aStream the stream
+   * @param aRange the range
+   * @return the range's index in the stream
    */
-  template <typename Type, std::enable_if_t<std::is_base_of_v<IStreamable, Type>, bool> = true>
-  [[nodiscard]] constexpr decltype(auto) ReadStreamable() noexcept
+  template <typename Range>
+  static size_t WriteElements(type_stream & aStream, const Range & aRange)
   {
-    const auto streamableSize = ReadSize();
-    Type streamable({ mStream.cbegin() + mIndex, mStream.cbegin() + mIndex + streamableSize });
-    mIndex += streamableSize;
+    using type_value = std::ranges::range_value_t<Range>;
+    static_assert(alignof(type_value) <= kAlignment, "The object's alignment is too big!");
 
-    return streamable;
+    const auto size  = std::ranges::size(aRange);
+    const auto index = Grow(aStream, sizeof(type_size_sub_stream), sizeof(type_size_sub_stream));
+    StreamableSizeFinder::WriteSize(aStream, index, size);
+
+    auto elements = Grow(aStream, alignof(type_value), size * sizeof(type_value));
+    if constexpr (std::ranges::contiguous_range<Range>)
+    {
+      // the data of an empty range can be null
+      if (size)
+      {
+        std::memcpy(aStream.data() + elements, std::ranges::data(aRange),
+                    size * sizeof(type_value));
+      }
+    }
+    else
+    {
+      // ranges like vector<bool> have proxies instead of elements
+      for (const type_value element : aRange)
+      {
+        std::memcpy(aStream.data() + elements, &element, sizeof(element));
+        elements += sizeof(element);
+      }
+    }
+
+    return index;
   }
 
   /**
-   * @brief Reads any nested range from the stream
-   * @tparam Type the nested range object type
-   * @return the nested range object
+   * @brief Writes the elements count of a range followed by the offsets of it's elements and
+   * the elements
+   * @tparam Range the range's type
+   * @param aStream the stream
+   * @param aRange the range
+   * @return the range's index in the stream
    */
-  template <std::ranges::range Range>
-  [[nodiscard]] constexpr decltype(auto) ReadRange()
+  template <typename Range>
+  static size_t WriteRange(type_stream & aStream, Range & aRange)
   {
-    Range      range{};
-    const auto size = ReadSize();
-    if constexpr (has_method_reserve_v<Range>)
+    const auto size  = std::ranges::size(aRange);
+    const auto index = Grow(aStream, sizeof(type_size_sub_stream),
+                            sizeof(type_size_sub_stream) * (size + 1));
+    StreamableSizeFinder::WriteSize(aStream, index, size);
+
+    auto offset = index + sizeof(type_size_sub_stream);
+    for (auto & element : aRange)
     {
-      range.reserve(size);
+      StreamableSizeFinder::WriteSize(aStream, offset, WriteObject(aStream, element) - index);
+      offset += sizeof(type_size_sub_stream);
     }
 
-    if constexpr (StreamableSizeFinder::FindRangeLayersCount<Range>() > 1)
+    return index;
+  }
+#pragma endregion
+
+#pragma region Read
+  /**
+   * @brief Views a variable size object in the stream
+   * @tparam Object the object's type
+   * @param aObject the object's first byte
+   * @return the object's view like the ones returned by View::Get
+   */
+  template <typename Object>
+  static [[nodiscard]] auto ViewObject(const type_stream_value * aObject) noexcept
+  {
+    if constexpr (is_basic_string_v<Object>)
     {
-      for (size_t i = 0; i < size; i++)
+      const auto elements = ViewElements<typename Object::value_type>(aObject);
+      return std::basic_string_view(elements.data(), elements.size());
+    }
+    else if constexpr (std::is_same_v<std::remove_cvref_t<Object>, std::filesystem::path>)
+    {
+      const auto elements = ViewElements<wchar_t>(aObject);
+      return std::wstring_view(elements.data(), elements.size());
+    }
+    else if constexpr (std::is_base_of_v<IStreamable, Object> && has_method_get_objects_v<Object>)
+    {
+      return View<Object>({ aObject, kLayout<Object>.mSize });
+    }
+    else if constexpr (std::ranges::range<Object> && !is_accepted_no_range_v<Object>)
+    {
+      if constexpr (is_known_size_v<std::ranges::range_value_t<Object>>)
       {
-        range.insert(std::ranges::cend(range), ReadRange<typename Range::value_type>());
+        return ViewElements<std::ranges::range_value_t<Object>>(aObject);
+      }
+      else
+      {
+        return RangeView<Object>(aObject);
       }
     }
     else
     {
-      for (size_t i = 0; i < size; i++)
-      {
-        range.insert(std::ranges::cend(range), Read<typename Range::value_type>());
-      }
+      return std::span(aObject + sizeof(type_size_sub_stream), Load<type_size_sub_stream>(aObject));
     }
+  }
 
-    return range;
+  /**
+   * @brief Views the elements of a range of known size objects in the stream
+   * @tparam Object the elements' type
+   * @param aRange the range's first byte
+   * @return the span of elements
+   */
+  template <typename Object>
+  static [[nodiscard]] std::span<const Object> ViewElements(
+    const type_stream_value * aRange) noexcept
+  {
+    const auto elements = Align(aRange + sizeof(type_size_sub_stream), alignof(Object));
+    return { std::launder(reinterpret_cast<const Object *>(elements)),
+             Load<type_size_sub_stream>(aRange) };
   }
 
   /**
-   * @brief Reads an object from the stream
-   * @tparam Type the stream's type
-   * @return a pair containing the stream start and it's size
+   * @brief Reads all the objects of a streamable from the stream
+   * @tparam Type the streamable's type
+   * @param aStreamable the streamable's first byte
+   * @param aObjects the streamable to read the objects to
    */
   template <typename Type>
-  [[nodiscard]] constexpr decltype(auto) ReadStream() noexcept
+  static void ReadStreamable(const type_stream_value * aStreamable, Type & aObjects)
   {
-    const auto spen(ReadObject());
-    const auto streamType = reinterpret_cast<Type::value_type *>(spen.data());
-    const auto streamSize = spen.size_bytes() / sizeof(Type::value_type);
+    auto objects = aObjects.GetObjects();
 
-    return std::pair{ streamType, streamSize };
+    [&]<size_t... aIndexes>(std::index_sequence<aIndexes...>)
+    {
+      (ReadMember(aStreamable, kLayout<Type>.mOffsets[aIndexes], std::get<aIndexes>(objects)),
+       ...);
+    }(std::make_index_sequence<std::tuple_size_v<decltype(objects)>>());
   }
 
   /**
-   * @brief Reads an object from the stream
-   * @return a span containing the object as a stream
+   * @brief Reads an object of a streamable from the stream
+   * @tparam Object the object's type
+   * @param aStreamable the streamable's first byte
+   * @param aOffset the object's offset or it's offset's offset in the header
+   * @param aObject the object
    */
-  [[nodiscard]] decltype(auto) ReadObject() noexcept
+  template <typename Object>
+  static void ReadMember(const type_stream_value * aStreamable, const size_t aOffset,
+                         Object & aObject)
   {
-    const auto                   size = ReadSize();
-    std::span<type_stream_value> spen(mStream.data() + mIndex, size);
-    mIndex += size;
-
-    return spen;
+    if constexpr (is_known_size_v<Object>)
+    {
+      aObject = Load<Object>(aStreamable + aOffset);
+    }
+    else
+    {
+      ReadObject(aStreamable + Load<type_size_sub_stream>(aStreamable + aOffset), aObject);
+    }
   }
 
   /**
-   * @brief Reads an object from stream
-   * @note the object's type must be a known size type
-   * @return the object
+   * @brief Reads a variable size object from the stream
+   * @tparam Object the object's type
+   * @param aPointer the object's first byte
+   * @param aObject the object
    */
-  template <typename Type>
-  [[nodiscard]] constexpr decltype(auto) ReadObjectOfKnownSize() noexcept
+  template <typename Object>
+  static void ReadObject(const type_stream_value * aPointer, Object & aObject)
   {
-    const auto objectPtr = reinterpret_cast<Type *>(mStream.data() + mIndex);
-    mIndex += sizeof(Type);
-    return *objectPtr;
+    if constexpr (is_basic_string_v<Object>)
+    {
+      aObject = Object(ViewObject<Object>(aPointer));
+    }
+    else if constexpr (std::is_same_v<std::remove_cvref_t<Object>, std::filesystem::path>)
+    {
+      aObject = std::wstring(ViewObject<Object>(aPointer));
+    }
+    else if constexpr (std::is_base_of_v<IStreamable, Object> && has_method_get_objects_v<Object>)
+    {
+      ReadStreamable(aPointer, aObject);
+    }
+    else if constexpr (std::ranges::range<Object> && !is_accepted_no_range_v<Object>)
+    {
+      using type_value = std::ranges::range_value_t<Object>;
+
+      Object     range{};
+      const auto view = ViewObject<Object>(aPointer);
+      if constexpr (has_method_reserve_v<Object>)
+      {
+        range.reserve(view.size());
+      }
+
+      for (size_t i = 0; i < view.size(); i++)
+      {
+        if constexpr (is_known_size_v<type_value>)
+        {
+          range.insert(std::ranges::cend(range), view[i]);
+        }
+        else
+        {
+          type_value element{};
+          ReadObject(aPointer + Load<type_size_sub_stream>(
+                                  aPointer + sizeof(type_size_sub_stream) * (i + 1)),
+                     element);
+          range.insert(std::ranges::cend(range), move(element));
+        }
+      }
+
+      aObject = move(range);
+    }
+    else
+    {
+      const auto       bytes = ViewObject<Object>(aPointer);
+      StreamableBuffer buffer(type_stream(bytes.begin(), bytes.end()));
+      aObject = buffer.Read<Object>();
+    }
   }
 #pragma endregion
 };
@@ -0,0 +1,822 @@
+#ifndef ISTREAMABLE_ASYNC_HPP
+#define ISTREAMABLE_ASYNC_HPP
+
+/*
+    Copyright (c) 2023 Claudiu HBann
+
+    See LICENSE for the full terms of the MIT License.
+*/
+
+#pragma region Includes
+
+#include "Streamable.hpp"
+
+#include <coroutine>  // std::coroutine_handle, std::suspend_always
+#include <iterator>   // std::default_sentinel_t
+#include <memory>     // std::addressof
+#include <optional>
+#include <utility>    // std::exchange
+
+#pragma endregion
+
+namespace hbann
+{
+/**
+ * @brief A lazy generator of values that are valid until the generator is resumed again
+ * @tparam Value the values' type
+ */
+template <typename Value>
+class StreamableGenerator
+{
+public:
+  struct promise_type
+  {
+    const Value * mValue{};
+
+    StreamableGenerator get_return_object() noexcept
+    {
+      return StreamableGenerator(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    std::suspend_always final_suspend() const noexcept { return {}; }
+
+    std::suspend_always yield_value(const Value & aValue) noexcept
+    {
+      mValue = std::addressof(aValue);
+      return {};
+    }
+
+    void return_void() const noexcept {}
+    void unhandled_exception() const { throw; }
+  };
+
+  class iterator
+  {
+  public:
+    using value_type      = Value;
+    using difference_type = std::ptrdiff_t;
+
+    iterator() noexcept = default;
+
+    explicit iterator(std::coroutine_handle<promise_type> aHandle) noexcept
+      : mHandle(aHandle)
+    {
+    }
+
+    [[nodiscard]] const Value & operator*() const noexcept { return *mHandle.promise().mValue; }
+
+    iterator & operator++()
+    {
+      mHandle.resume();
+      return *this;
+    }
+
+    void operator++(int) { ++*this; }
+
+    [[nodiscard]] bool operator==(std::default_sentinel_t) const noexcept
+    {
+      return !mHandle || mHandle.done();
+    }
+
+  private:
+    std::coroutine_handle<promise_type> mHandle{};
+  };
+
+  StreamableGenerator(StreamableGenerator && aGenerator) noexcept
+    : mHandle(std::exchange(aGenerator.mHandle, {}))
+  {
+  }
+
+  StreamableGenerator & operator=(StreamableGenerator && aGenerator) noexcept
+  {
+    std::swap(mHandle, aGenerator.mHandle);
+    return *this;
+  }
+
+  ~StreamableGenerator()
+  {
+    if (mHandle)
+    {
+      mHandle.destroy();
+    }
+  }
+
+  /**
+   * @brief Starts the generator
+   * @return the iterator to the first value
+   */
+  [[nodiscard]] iterator begin()
+  {
+    mHandle.resume();
+    return iterator(mHandle);
+  }
+
+  [[nodiscard]] std::default_sentinel_t end() const noexcept { return {}; }
+
+private:
+  std::coroutine_handle<promise_type> mHandle{};
+
+  explicit StreamableGenerator(std::coroutine_handle<promise_type> aHandle) noexcept
+    : mHandle(aHandle)
+  {
+  }
+};
+
+/**
+ * @brief A lazy task that can be awaited by another coroutine or started by anyone
+ * @note The awaiting coroutine is resumed when the task finishes
+ */
+class StreamableTask
+{
+public:
+  struct promise_type
+  {
+    std::coroutine_handle<> mContinuation{};
+
+    /**
+     * @brief Resumes the awaiting coroutine if there is one
+     */
+    struct FinalAwaiter
+    {
+      bool await_ready() const noexcept { return false; }
+
+      std::coroutine_handle<> await_suspend(
+        std::coroutine_handle<promise_type> aHandle) const noexcept
+      {
+        const auto continuation = aHandle.promise().mContinuation;
+        return continuation ? continuation : std::noop_coroutine();
+      }
+
+      void await_resume() const noexcept {}
+    };
+
+    StreamableTask get_return_object() noexcept
+    {
+      return StreamableTask(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    FinalAwaiter        final_suspend() const noexcept { return {}; }
+
+    void return_void() const noexcept {}
+    void unhandled_exception() const { throw; }
+  };
+
+  StreamableTask(StreamableTask && aTask) noexcept
+    : mHandle(std::exchange(aTask.mHandle, {}))
+  {
+  }
+
+  StreamableTask & operator=(StreamableTask && aTask) noexcept
+  {
+    std::swap(mHandle, aTask.mHandle);
+    return *this;
+  }
+
+  ~StreamableTask()
+  {
+    if (mHandle)
+    {
+      mHandle.destroy();
+    }
+  }
+
+  /**
+   * @brief Starts the task from a function that is not a coroutine
+   */
+  void Start() { mHandle.resume(); }
+
+  /**
+   * @brief Checks if the task finished
+   * @return true if the task finished
+   */
+  [[nodiscard]] bool IsDone() const noexcept { return mHandle.done(); }
+
+  bool await_ready() const noexcept { return mHandle.done(); }
+
+  std::coroutine_handle<> await_suspend(std::coroutine_handle<> aContinuation) const noexcept
+  {
+    mHandle.promise().mContinuation = aContinuation;
+    return mHandle;
+  }
+
+  void await_resume() const noexcept {}
+
+private:
+  std::coroutine_handle<promise_type> mHandle{};
+
+  explicit StreamableTask(std::coroutine_handle<promise_type> aHandle) noexcept
+    : mHandle(aHandle)
+  {
+  }
+};
+
+/**
+ * @brief Serializes a streamable in chunks of bounded size so a single threaded event loop can
+ * do other work between them
+ * @note The objects that fit in the current chunk are written at once like IStreamable writes
+ * them, while the bigger ones are split: their objects, elements or bytes are written one by one
+ * and the chunk is yielded every time it fills up
+ * @note The chunks' bytes are the same as the ones returned by ToStream
+ * @note The whole generator is a single encode that is entered again every time it's resumed, so
+ * the objects sizes are calculated once even if a deep tree is split, and it's not entered while
+ * the generator is suspended and other encodes run on the same thread
+ */
+class StreamableEncoder
+{
+public:
+  using type_size_sub_stream = IStreamable::type_size_sub_stream;
+  using type_chunk           = std::span<const uint8_t>;
+
+  static constexpr size_t kChunkSizeDefault = 64 * 1024;
+
+  /**
+   * @brief Serializes the streamable in chunks
+   * @note The streamable must not be modified until the generator finishes
+   * @tparam Type the streamable's type that must be defined with one of the ISTREAMABLE_DEFINE_X
+   * macros
+   * @param aStreamable the streamable
+   * @param aChunkSize the maximum size in bytes of a chunk
+   * @return the generator of chunks that are valid until the generator is resumed again
+   */
+  template <typename Type>
+  static [[nodiscard]] StreamableGenerator<type_chunk> Encode(
+    Type & aStreamable, const size_t aChunkSize = kChunkSizeDefault)
+  {
+StreamableSizeFinder::AssertStreamable<Type>();
+
+    StreamableEncoder encoder(aChunkSize);
+    for (const auto chunk : encoder.WriteStreamableObjects(aStreamable))
+    {
+      co_yield chunk;
+    }
+
+    if (!encoder.mBuffer.mStream.empty())
+    {
+      co_yield type_chunk(encoder.mBuffer.mStream);
+    }
+  }
+
+private:
+  size_t           mChunkSize{};
+  size_t           mEncode{};  // the encode's id, entered by every part written synchronously
+  StreamableBuffer mBuffer{};  // the current chunk
+
+  explicit StreamableEncoder(const size_t aChunkSize) noexcept
+    : mChunkSize(std::max<size_t>(aChunkSize, 1))
+  {
+  }
+
+  /**
+   * @brief Writes the object at once if it fits in the current chunk
+   * @tparam Object the object's type
+   * @param aObject the object
+   * @return true if the object was written
+   */
+  template <typename Object>
+  [[nodiscard]] bool TryWrite(Object & aObject)
+  {
+    IStreamable::EncodeScope encodeScope(mEncode);
+
+    if (mBuffer.mStream.size() + StreamableSizeFinder::FindObjectsSize(aObject) > mChunkSize)
+    {
+      return false;
+    }
+
+    mBuffer.Write(aObject);
+    return true;
+  }
+
+  /**
+   * @brief Finds the size of a streamable's objects in the encode
+   * @note The scope ends before the caller yields so the encode is not entered while suspended
+   * @tparam Type the streamable's type
+   * @param aStreamable the streamable
+   * @return the size in bytes of the streamable's objects
+   */
+  template <typename Type>
+  [[nodiscard]] type_size_sub_stream FindSize(Type & aStreamable)
+  {
+    IStreamable::EncodeScope encodeScope(mEncode);
+    return type_size_sub_stream(StreamableSizeFinder::FindObjectSize(aStreamable) -
+                                sizeof(type_size_sub_stream));
+  }
+
+  /**
+   * @brief Writes the bytes to the chunks yielding every chunk that fills up
+   * @param aBytes the bytes
+   * @param aSize the number of bytes
+   * @return the generator of the full chunks
+   */
+  StreamableGenerator<type_chunk> WriteBytes(const void * aBytes, size_t aSize)
+  {
+    auto bytes = static_cast<const uint8_t *>(aBytes);
+    while (aSize)
+    {
+      const auto size = std::min(aSize, mChunkSize - mBuffer.mStream.size());
+      mBuffer.WriteBytes(bytes, size);
+      bytes += size;
+      aSize -= size;
+
+      if (mBuffer.mStream.size() == mChunkSize)
+      {
+        co_yield type_chunk(mBuffer.mStream);
+        mBuffer.Clear();
+      }
+    }
+  }
+
+  /**
+   * @brief Writes an object that doesn't fit in the current chunk split in smaller parts
+   * @tparam Object the object's type
+   * @param aObject the object
+   * @return the generator of the full chunks
+   */
+  template <typename Object>
+  StreamableGenerator<type_chunk> Write(Object & aObject)
+  {
+    if constexpr (is_basic_string_v<Object>)
+    {
+      const auto size = type_size_sub_stream(aObject.size() * sizeof(typename Object::value_type));
+      for (const auto chunk : WriteBytes(&size, sizeof(size)))
+      {
+        co_yield chunk;
+      }
+      for (const auto chunk : WriteBytes(aObject.data(), size))
+      {
+        co_yield chunk;
+      }
+    }
+    else if constexpr (std::is_same_v<std::remove_cvref_t<Object>, std::filesystem::path>)
+    {
+      auto wstr(aObject.wstring());
+      for (const auto chunk : Write(wstr))
+      {
+        co_yield chunk;
+      }
+    }
+    else if constexpr (is_known_size_v<Object>)
+    {
+      for (const auto chunk : WriteBytes(&aObject, sizeof(aObject)))
+      {
+        co_yield chunk;
+      }
+    }
+    else if constexpr (std::is_base_of_v<IStreamable, Object> && has_method_get_objects_v<Object>)
+    {
+      const auto size = FindSize(aObject);
+      for (const auto chunk : WriteBytes(&size, sizeof(size)))
+      {
+        co_yield chunk;
+      }
+      for (const auto chunk : WriteStreamableObjects(aObject))
+      {
+        co_yield chunk;
+      }
+    }
+    else if constexpr (std::ranges::range<Object> && !is_accepted_no_range_v<Object>)
+    {
+      for (const auto chunk : WriteRange(aObject))
+      {
+        co_yield chunk;
+      }
+    }
+    else
+    {
+      // the streamables without GetObjects, the columnar ranges and the delta ranges are not
+      // split while they are written so their stream is split after
+      StreamableBuffer buffer;
+      {
+        IStreamable::EncodeScope encodeScope(mEncode);
+        buffer.Write(aObject);
+      }
+
+      for (const auto chunk : WriteBytes(buffer.mStream.data(), buffer.mStream.size()))
+      {
+        co_yield chunk;
+      }
+    }
+  }
+
+  /**
+   * @brief Writes the objects of a streamable without it's leading size
+   * @tparam Type the streamable's type
+   * @param aStreamable the streamable
+   * @return the generator of the full chunks
+   */
+  template <typename Type>
+  StreamableGenerator<type_chunk> WriteStreamableObjects(Type & aStreamable)
+  {
+    auto           objects      = aStreamable.GetObjects();
+    constexpr auto objectsCount = std::tuple_size_v<decltype(objects)>;
+
+    for (size_t index = 0; index < objectsCount; index++)
+    {
+      // the objects have different types so the current one is found at runtime
+      std::optional<StreamableGenerator<type_chunk>> generator{};
+      [&]<size_t... aIndexes>(std::index_sequence<aIndexes...>)
+      {
+        ((index == aIndexes && !TryWrite(std::get<aIndexes>(objects))
+            ? void(generator.emplace(Write(std::get<aIndexes>(objects))))
+            : void()),
+         ...);
+      }(std::make_index_sequence<objectsCount>());
+
+      if (generator)
+      {
+        for (const auto chunk : *generator)
+        {
+          co_yield chunk;
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Writes a range that doesn't fit in the current chunk element by element
+   * @tparam Range the range's type
+   * @param aRange the range
+   * @return the generator of the full chunks
+   */
+  template <std::ranges::range Range>
+  StreamableGenerator<type_chunk> WriteRange(Range & aRange)
+  {
+    using type_value = std::ranges::range_value_t<Range>;
+
+    const auto size = type_size_sub_stream(std::ranges::size(aRange));
+    for (const auto chunk : WriteBytes(&size, sizeof(size)))
+    {
+      co_yield chunk;
+    }
+
+    if constexpr (std::ranges::contiguous_range<Range> && is_known_size_v<type_value>)
+    {
+      for (const auto chunk :
+           WriteBytes(std::ranges::data(aRange), std::ranges::size(aRange) * sizeof(type_value)))
+      {
+        co_yield chunk;
+      }
+    }
+    else
+    {
+      for (auto && object : aRange)
+      {
+        if (!TryWrite(object))
+        {
+          for (const auto chunk : Write(object))
+          {
+            co_yield chunk;
+          }
+        }
+      }
+    }
+  }
+};
+
+/**
+ * @brief Deserializes a streamable from chunks of bytes that arrive over time, the decoding
+ * coroutine suspends when the input runs out and it's resumed by Feed when enough bytes arrived
+ * @note Every object is read like IStreamable reads it as soon as all it's bytes arrived, their
+ * size is found from the leading sizes (see StreamableAccessor) without decoding them
+ * @note The ranges are read while they arrive, element by element or as many known size elements
+ * as arrived, but the rest of the objects (strings, nested streamables, columnar and delta ranges
+ * etc...) are buffered whole before they are read, so a big one needs all it's bytes in memory
+ * @note ex.: StreamableDecoder decoder(message); auto task = decoder.Decode(); task.Start();
+ * then decoder.Feed(chunk) for every chunk until task.IsDone() or co_await decoder.Decode()
+ * @tparam Type the streamable's type that must be defined with one of the ISTREAMABLE_DEFINE_X
+ * macros
+ */
+template <typename Type>
+class StreamableDecoder
+{
+public:
+  using type_size_sub_stream = IStreamable::type_size_sub_stream;
+  using type_chunk           = std::span<const uint8_t>;
+
+  /**
+   * @brief Prepares the decoding
+   * @param aStreamable the streamable to read the objects to
+   */
+  explicit StreamableDecoder(Type & aStreamable) noexcept
+    : mStreamable(aStreamable)
+  {
+StreamableSizeFinder::AssertStreamable<Type>();
+  }
+
+  /**
+   * @brief Decodes the streamable from the chunks passed to Feed
+   * @return the task that finishes when all the objects were read
+   */
+  [[nodiscard]] StreamableTask Decode()
+  {
+    auto           objects      = mStreamable.GetObjects();
+    constexpr auto objectsCount = std::tuple_size_v<decltype(objects)>;
+
+    for (size_t index = 0; index < objectsCount; index++)
+    {
+      // the objects have different types so the current one is found at runtime
+      std::optional<StreamableTask> task{};
+      [&]<size_t... aIndexes>(std::index_sequence<aIndexes...>)
+      {
+        ((index == aIndexes ? void(task.emplace(ReadObject(std::get<aIndexes>(objects))))
+                            : void()),
+         ...);
+      }(std::make_index_sequence<objectsCount>());
+
+      co_await std::move(*task);
+    }
+  }
+
+  /**
+   * @brief Adds a chunk of bytes and resumes the decoding if it was waiting for them
+   * @param aChunk the chunk
+   */
+  void Feed(type_chunk aChunk)
+  {
+    // the bytes that were read are dropped just when they are most of the buffer so feeding many
+    // small chunks doesn't move the bytes that are not read yet every time
+    if (mBuffer.mIndex > mBuffer.mStream.size() / 2)
+    {
+      mBuffer.mStream.erase(mBuffer.mStream.begin(), mBuffer.mStream.begin() + mBuffer.mIndex);
+      mBuffer.mIndex = {};
+    }
+
+    mBuffer.mStream.insert(mBuffer.mStream.end(), aChunk.begin(), aChunk.end());
+
+    if (mWaiting && IsAvailable(mNeeded))
+    {
+      std::exchange(mWaiting, {}).resume();
+    }
+  }
+
+private:
+  /**
+   * @brief Suspends the decoding until the bytes are available
+   */
+  struct Awaiter
+  {
+    StreamableDecoder & mDecoder;
+    size_t              mSize{};
+
+    bool await_ready() const noexcept { return mDecoder.IsAvailable(mSize); }
+
+    void await_suspend(std::coroutine_handle<> aHandle) const noexcept
+    {
+      mDecoder.mWaiting = aHandle;
+      mDecoder.mNeeded  = mSize;
+    }
+
+    void await_resume() const noexcept {}
+  };
+
+  /**
+   * @brief Checks if the range's elements have sizes that are found one by one while they arrive
+   */
+  template <typename Object>
+  static constexpr bool is_split_range_v = []
+  {
+    if constexpr (std::ranges::range<Object> && !is_accepted_no_range_v<Object>)
+    {
+      return !is_known_size_v<std::ranges::range_value_t<Object>>;
+    }
+    else
+    {
+      return false;
+    }
+  }();
+
+  /**
+   * @brief Checks if the range's known size elements are copied directly in it while they arrive
+   */
+  template <typename Object>
+  static constexpr bool is_contiguous_range_v = []
+  {
+    if constexpr (std::ranges::contiguous_range<Object> && !is_accepted_no_range_v<Object>)
+    {
+      return is_known_size_v<std::ranges::range_value_t<Object>> &&
+             requires(Object & aRange) { aRange.resize(0); };
+    }
+    else
+    {
+      return false;
+    }
+  }();
+
+  Type &                  mStreamable;
+  StreamableBuffer        mBuffer{};  // the bytes that arrived, read from it's index
+  std::coroutine_handle<> mWaiting{};
+  size_t                  mNeeded{};
+
+  /**
+   * @brief Checks if enough bytes that are not read yet arrived
+   * @param aSize the number of bytes
+   * @return true if the bytes arrived
+   */
+  [[nodiscard]] bool IsAvailable(const size_t aSize) const noexcept
+  {
+    return mBuffer.mStream.size() - mBuffer.mIndex >= aSize;
+  }
+
+  /**
+   * @brief Waits until the bytes are available
+   * @param aSize the number of bytes that are not read yet
+   * @return the awaiter
+   */
+  [[nodiscard]] Awaiter Need(const size_t aSize) noexcept { return { *this, aSize }; }
+
+  /**
+   * @brief Reads an object after all it's bytes arrived
+   * @note The ranges with elements that don't have a known size are read element by element and
+   * the contiguous ranges of known size elements as their elements arrive, so a big range doesn't
+   * block the caller of Feed while it's read at once or wait for all it's bytes
+   * @tparam Object the object's type
+   * @param aObject the object
+   * @return the task that finishes when the object was read
+   */
+  template <typename Object>
+  StreamableTask ReadObject(Object & aObject)
+  {
+    if constexpr (is_split_range_v<Object>)
+    {
+      using type_value = std::ranges::range_value_t<Object>;
+
+      co_await Need(sizeof(type_size_sub_stream));
+      const size_t count = mBuffer.ReadSize();
+
+      Object range{};
+      if constexpr (has_method_reserve_v<Object>)
+      {
+        range.reserve(count);
+      }
+
+      for (size_t i = 0; i < count; i++)
+      {
+        // awaited in place because a task for every element would allocate it's frame
+        size_t size{};
+        while (!FindObjectSize<type_value>(0, size))
+        {
+          co_await Need(mNeeded);
+        }
+        co_await Need(size);
+
+        range.insert(std::ranges::cend(range), mBuffer.Read<type_value>());
+      }
+
+      aObject = move(range);
+    }
+    else if constexpr (is_contiguous_range_v<Object>)
+    {
+      using type_value = std::ranges::range_value_t<Object>;
+
+      co_await Need(sizeof(type_size_sub_stream));
+      const size_t count = mBuffer.ReadSize();
+
+      Object range{};
+      range.resize(count);
+      for (size_t i = 0; i < count;)
+      {
+        co_await Need(sizeof(type_value));
+
+        // copies all the elements that arrived
+        const auto available = (mBuffer.mStream.size() - mBuffer.mIndex) / sizeof(type_value);
+        const auto copied    = std::min(count - i, available);
+        std::memcpy(std::ranges::data(range) + i, mBuffer.mStream.data() + mBuffer.mIndex,
+                    copied * sizeof(type_value));
+        mBuffer.mIndex += copied * sizeof(type_value);
+        i += copied;
+      }
+
+      aObject = move(range);
+    }
+    else
+    {
+      size_t size{};
+      while (!FindObjectSize<Object>(0, size))
+      {
+        co_await Need(mNeeded);
+      }
+      co_await Need(size);
+
+      aObject = mBuffer.Read<Object>();
+    }
+  }
+
+  /**
+   * @brief Finds the size in bytes of an object if the leading sizes that are needed arrived
+   * @note When a leading size is missing mNeeded is set to the number of bytes needed
+   * @tparam Object the object's type
+   * @param aIndex the object's position from the first byte that is not read yet
+   * @param aSize the object's size in bytes including it's leading size
+   * @return true if the size was found
+   */
+  template <typename Object>
+  [[nodiscard]] bool FindObjectSize(const size_t aIndex, size_t & aSize) noexcept
+  {
+    if constexpr (is_basic_string_v<Object> ||
+                  std::is_same_v<std::remove_cvref_t<Object>, std::filesystem::path>)
+    {
+      return FindStreamSize(aIndex, 0, aSize);
+    }
+    else if constexpr (is_known_size_v<Object>)
+    {
+      aSize = sizeof(Object);
+      return true;
+    }
+    else if constexpr (std::is_base_of_v<IStreamable, Object>)
+    {
+      return FindStreamSize(aIndex, 0, aSize);
+    }
+    else if constexpr (is_columnar_range_v<Object>)
+    {
+      auto index = aIndex + sizeof(type_size_sub_stream);
+      for (size_t column = 0; column < std::tuple_size_v<typename Object::type_columns>; column++)
+      {
+        size_t columnSize{};
+        if (!FindStreamSize(index, 0, columnSize))
+        {
+          return false;
+        }
+        index += columnSize;
+      }
+
+      aSize = index - aIndex;
+      return true;
+    }
+    else if constexpr (is_delta_range_v<Object>)
+    {
+      // the blocks' size follows the elements count
+      return FindStreamSize(aIndex, sizeof(type_size_sub_stream), aSize);
+    }
+    else if constexpr (std::ranges::range<Object>)
+    {
+      using type_value = std::ranges::range_value_t<Object>;
+
+      if (!IsAvailable(aIndex + sizeof(type_size_sub_stream)))
+      {
+        mNeeded = aIndex + sizeof(type_size_sub_stream);
+        return false;
+      }
+
+      const auto count = ReadSize(aIndex);
+      auto       index = aIndex + sizeof(type_size_sub_stream);
+      if constexpr (is_known_size_v<type_value>)
+      {
+        index += count * sizeof(type_value);
+      }
+      else
+      {
+        for (size_t i = 0; i < count; i++)
+        {
+          size_t elementSize{};
+          if (!FindObjectSize<type_value>(index, elementSize))
+          {
+            return false;
+          }
+          index += elementSize;
+        }
+      }
+
+      aSize = index - aIndex;
+      return true;
+    }
+    else
+    {
+      StreamableSizeFinder::AssertAccepted<Object, false>();
+    }
+  }
+
+  /**
+   * @brief Finds the size in bytes of a stream that has a leading size
+   * @param aIndex the stream's position from the first byte that is not read yet
+   * @param aSizeIndex the leading size's position in the stream
+   * @param aSize the stream's size in bytes including everything until the leading size's end
+   * @return true if the leading size arrived
+   */
+  [[nodiscard]] bool FindStreamSize(const size_t aIndex, const size_t aSizeIndex,
+                                    size_t & aSize) noexcept
+  {
+    const auto sizeEnd = aIndex + aSizeIndex + sizeof(type_size_sub_stream);
+    if (!IsAvailable(sizeEnd))
+    {
+      mNeeded = sizeEnd;
+      return false;
+    }
+
+    aSize = sizeEnd - aIndex + ReadSize(aIndex + aSizeIndex);
+    return true;
+  }
+
+  /**
+   * @brief Reads a size from the bytes that are not read yet
+   * @param aIndex the size's position from the first byte that is not read yet
+   * @return the size
+   */
+  [[nodiscard]] type_size_sub_stream ReadSize(const size_t aIndex) const noexcept
+  {
+    return StreamableSizeFinder::ReadSize(mBuffer.mStream, mBuffer.mIndex + aIndex);
+  }
+};
+}  // namespace hbann
+
+#endif  // !ISTREAMABLE_ASYNC_HPP
@@ -0,0 +1,434 @@
+#ifndef ISTREAMABLE_RING_HPP
+#define ISTREAMABLE_RING_HPP
+
+/*
+    Copyright (c) 2023 Claudiu HBann
+
+    See LICENSE for the full terms of the MIT License.
+*/
+
+#pragma region Includes
+
+#include "Streamable.hpp"
+
+#include <atomic>  // std::atomic, std::atomic_ref
+#include <string>
+#include <vector>
+
+#include <fcntl.h>     // O_CREAT, O_EXCL, O_RDWR
+#include <sys/mman.h>  // shm_open, shm_unlink, mmap, munmap
+#include <sys/stat.h>  // fstat
+#include <unistd.h>    // ftruncate, close
+
+#pragma endregion
+
+namespace hbann
+{
+/**
+ * @brief A lock-free ring of streams in POSIX shared memory used to pass streamables between
+ * processes on the same host without pipes
+ * @note Format: a header with the producers' and the consumer's positions followed by the
+ * records, where a record is it's state as an uint32_t (committed or padding + the stream's
+ * size), 4 unused bytes and the stream padded to kAlignment bytes, a padding record fills the
+ * end of the ring when the next record doesn't fit there
+ * @note The producers reserve a record, copy the streamable's segments to it and commit it by
+ * storing it's state last, the consumer reads the committed records in place and zeroes them
+ * before releasing their memory so a zero state always means a record that's not committed yet
+ * @note Batches of records are reserved and released at once so the shared positions are
+ * touched once per batch
+ * @tparam aMultipleProducers true if multiple producers write concurrently (MPSC), their
+ * reservations are done with a compare exchange instead of a store
+ */
+template <bool aMultipleProducers = false>
+class StreamableRing
+{
+public:
+  using type_stream       = std::span<uint8_t>;
+  using type_stream_const = std::span<const uint8_t>;
+  using type_state        = uint32_t;
+
+  static constexpr size_t     kAlignment = 8;  // the alignment of the records and their streams
+  static constexpr type_state kCommitted = type_state(1) << 31;
+  static constexpr type_state kPadding   = type_state(1) << 30;
+  static constexpr type_state kSizeMask  = kPadding - 1;
+
+  /**
+   * @brief Creates the ring replacing any shared memory object with the same name
+   * @note The shared memory object is removed when the creator is destroyed
+   * @param aName the shared memory object's name (ex.: "/streamables")
+   * @param aCapacity the ring's capacity in bytes that is rounded up to a power of two
+   */
+  StreamableRing(const std::string & aName, const size_t aCapacity)
+    : mName(aName)
+    , mOwner(true)
+  {
+    const auto capacity = std::bit_ceil(std::max(aCapacity, kAlignment));
+    assert(capacity <= size_t(kSizeMask) + 1);
+
+    shm_unlink(aName.c_str());
+    const auto fd = shm_open(aName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd == -1)
+    {
+      return;
+    }
+
+    // the new memory is zeroed so all the records are not committed
+    if (!ftruncate(fd, off_t(sizeof(Header) + capacity)))
+    {
+      Map(fd, sizeof(Header) + capacity);
+    }
+    close(fd);
+  }
+
+  /**
+   * @brief Opens a ring created by another process
+   * @param aName the shared memory object's name
+   */
+  explicit StreamableRing(const std::string & aName)
+    : mName(aName)
+  {
+    const auto fd = shm_open(aName.c_str(), O_RDWR, 0);
+    if (fd == -1)
+    {
+      return;
+    }
+
+    struct stat status{};
+    if (!fstat(fd, &status) && size_t(status.st_size) > sizeof(Header))
+    {
+      Map(fd, size_t(status.st_size));
+    }
+    close(fd);
+  }
+
+  StreamableRing(const StreamableRing &)             = delete;
+  StreamableRing & operator=(const StreamableRing &) = delete;
+
+  /**
+   * @brief Unmaps the ring and removes it if it was created by us
+   */
+  ~StreamableRing()
+  {
+    if (mHeader)
+    {
+      munmap(mHeader, sizeof(Header) + mCapacity);
+    }
+
+    if (mOwner)
+    {
+      shm_unlink(mName.c_str());
+    }
+  }
+
+  /**
+   * @brief Checks if the ring was created or opened successfully
+   * @return true if the ring can be used
+   */
+  [[nodiscard]] bool IsOpen() const noexcept { return mHeader; }
+
+  /**
+   * @brief Gets the ring's capacity
+   * @return the ring's capacity in bytes
+   */
+  [[nodiscard]] size_t GetCapacity() const noexcept { return mCapacity; }
+
+#pragma region Producer
+
+  /**
+   * @brief Reserves a record that must be committed with Commit after the stream is written
+   * @param aSize the stream's size in bytes
+   * @return the record's stream or an empty stream without data if the ring is full
+   */
+  [[nodiscard]] type_stream Reserve(const size_t aSize) noexcept
+  {
+    const auto record = ReserveRecords(FindRecordSize(aSize));
+    return record ? type_stream{ record + kAlignment, aSize } : type_stream{};
+  }
+
+  /**
+   * @brief Commits a reserved record so the consumer can read it
+   * @param aStream the record's stream returned by Reserve
+   */
+  void Commit(type_stream aStream) noexcept
+  {
+    StoreState(aStream.data() - kAlignment, kCommitted | type_state(aStream.size()));
+  }
+
+  /**
+   * @brief Writes the streamable to a record without serializing it to it's own stream first
+   * @note The streamable is serialized to segments (see StreamableSegments) that are copied to
+   * the record
+   * @tparam Type the streamable's type
+   * @param aStreamable the streamable
+   * @return true if the ring had space for the streamable
+   */
+  template <typename Type>
+  [[nodiscard]] bool Write(Type & aStreamable)
+  {
+    const StreamableSegments segments(aStreamable);
+
+    const auto stream = Reserve(segments.GetSize());
+    if (!stream.data())
+    {
+      return false;
+    }
+
+    WriteSegments(stream.data(), segments);
+    Commit(stream);
+
+    return true;
+  }
+
+  /**
+   * @brief Writes all the streamables to consecutive records reserved at once
+   * @note The streamables are written all or none
+   * @tparam Range the streamables range's type
+   * @param aStreamables the streamables
+   * @return true if the ring had space for all the streamables
+   */
+  template <std::ranges::range Range>
+  [[nodiscard]] bool WriteAll(Range & aStreamables)
+  {
+    std::vector<StreamableSegments> segmentsAll;
+    size_t                          recordsSize{};
+    for (auto & streamable : aStreamables)
+    {
+      recordsSize += FindRecordSize(segmentsAll.emplace_back(streamable).GetSize());
+    }
+
+    auto record = ReserveRecords(recordsSize);
+    if (!record)
+    {
+      return false;
+    }
+
+    for (const auto & segments : segmentsAll)
+    {
+      WriteSegments(record + kAlignment, segments);
+      Commit({ record + kAlignment, segments.GetSize() });
+      record += FindRecordSize(segments.GetSize());
+    }
+
+    return true;
+  }
+
+#pragma endregion
+
+#pragma region Consumer
+
+  /**
+   * @brief Reads the committed records in place and releases their memory at once
+   * @note The stream passed to the callback is valid just until the callback returns
+   * @tparam Callback the callback's type
+   * @param aCallback the callback that receives every record's stream
+   * @param aCount the maximum number of records to read
+   * @return the number of records read
+   */
+  template <typename Callback>
+  size_t ReadAll(Callback && aCallback, const size_t aCount = SIZE_MAX)
+  {
+    const auto start = mHeader->mTail.load(std::memory_order_relaxed);
+    auto       tail  = start;
+
+    // a full lap ends at the first record read which is not zeroed yet so it looks committed
+    size_t count{};
+    while (count < aCount && tail - start < mCapacity)
+    {
+      const auto record = mData + (tail & (mCapacity - 1));
+      const auto state  = LoadState(record);
+      if (!state)
+      {
+        break;
+      }
+
+      const auto size = size_t(state & kSizeMask);
+      if (state & kPadding)
+      {
+        tail += size;
+        continue;
+      }
+
+      aCallback(type_stream_const{ record + kAlignment, size });
+      tail += FindRecordSize(size);
+      count++;
+    }
+
+    if (tail != start)
+    {
+      Zero(start, tail);
+      mHeader->mTail.store(tail, std::memory_order_release);
+    }
+
+    return count;
+  }
+
+  /**
+   * @brief Reads the next committed record to a streamable
+   * @tparam Type the streamable's type
+   * @param aStreamable the streamable
+   * @return true if there was a committed record
+   */
+  template <typename Type>
+  [[nodiscard]] bool Read(Type & aStreamable)
+  {
+    return ReadAll(
+      [&](const type_stream_const aStream)
+      {
+        aStreamable = Type(IStreamable::type_stream(aStream.begin(), aStream.end()));
+      },
+      1);
+  }
+
+#pragma endregion
+
+private:
+  /**
+   * @brief The positions shared by the processes, each one on it's own cache line
+   * @note The positions only grow, a record's index is it's position modulo the capacity
+   */
+  struct Header
+  {
+    alignas(64) std::atomic<uint64_t> mHead{};  // the end of the reserved records
+    alignas(64) std::atomic<uint64_t> mTail{};  // the end of the released records
+  };
+
+  std::string mName{};
+  bool        mOwner{};
+  Header *    mHeader{};
+  uint8_t *   mData{};
+  size_t      mCapacity{};
+  uint64_t    mTailCached{};  // the last tail seen by the producer
+
+  /**
+   * @brief Maps the shared memory object
+   * @param aFile the shared memory object's file descriptor
+   * @param aSize the shared memory object's size in bytes
+   */
+  void Map(const int aFile, const size_t aSize) noexcept
+  {
+    const auto memory = mmap(nullptr, aSize, PROT_READ | PROT_WRITE, MAP_SHARED, aFile, 0);
+    if (memory == MAP_FAILED)
+    {
+      return;
+    }
+
+    mHeader   = static_cast<Header *>(memory);
+    mData     = static_cast<uint8_t *>(memory) + sizeof(Header);
+    mCapacity = aSize - sizeof(Header);
+  }
+
+  /**
+   * @brief Calculates the size of a record
+   * @param aSize the record's stream size in bytes
+   * @return the record's size in bytes
+   */
+  static [[nodiscard]] constexpr size_t FindRecordSize(const size_t aSize) noexcept
+  {
+    return kAlignment + (aSize + kAlignment - 1) / kAlignment * kAlignment;
+  }
+
+  /**
+   * @brief Reserves contiguous records adding a padding record before them if they don't fit at
+   * the end of the ring
+   * @param aRecordsSize the records' size in bytes
+   * @return the first record or nullptr if the ring is full
+   */
+  [[nodiscard]] uint8_t * ReserveRecords(const size_t aRecordsSize) noexcept
+  {
+    if (aRecordsSize > mCapacity)
+    {
+      return nullptr;
+    }
+
+    auto head = mHeader->mHead.load(std::memory_order_relaxed);
+    while (true)
+    {
+      const auto index   = head & (mCapacity - 1);
+      const auto padding = mCapacity - index < aRecordsSize ? mCapacity - index : 0;
+      const auto headNew = head + padding + aRecordsSize;
+
+      if (headNew > mTailCached + mCapacity)
+      {
+        mTailCached = mHeader->mTail.load(std::memory_order_acquire);
+        if (headNew > mTailCached + mCapacity)
+        {
+          return nullptr;
+        }
+      }
+
+      if constexpr (aMultipleProducers)
+      {
+        if (!mHeader->mHead.compare_exchange_weak(head, headNew, std::memory_order_relaxed))
+        {
+          continue;
+        }
+      }
+      else
+      {
+        mHeader->mHead.store(headNew, std::memory_order_relaxed);
+      }
+
+      if (padding)
+      {
+        StoreState(mData + index, kPadding | type_state(padding));
+      }
+
+      return mData + ((head + padding) & (mCapacity - 1));
+    }
+  }
+
+  /**
+   * @brief Copies the segments to a record's stream
+   * @param aStream the record's stream
+   * @param aSegments the segments
+   */
+  static void WriteSegments(uint8_t * aStream, const StreamableSegments & aSegments) noexcept
+  {
+    for (const auto & segment : aSegments.GetSegments())
+    {
+      std::memcpy(aStream, segment.iov_base, segment.iov_len);
+      aStream += segment.iov_len;
+    }
+  }
+
+  /**
+   * @brief Zeroes the released records so their states mean not committed again
+   * @param aStart the first record's position
+   * @param aEnd the end of the last record's position
+   */
+  void Zero(uint64_t aStart, const uint64_t aEnd) noexcept
+  {
+    while (aStart != aEnd)
+    {
+      const auto index = aStart & (mCapacity - 1);
+      const auto size  = std::min<uint64_t>(aEnd - aStart, mCapacity - index);
+      std::memset(mData + index, 0, size);
+      aStart += size;
+    }
+  }
+
+  /**
+   * @brief Stores a record's state publishing the record
+   * @param aRecord the record
+   * @param aState the state
+   */
+  static void StoreState(uint8_t * aRecord, const type_state aState) noexcept
+  {
+    std::atomic_ref(*reinterpret_cast<type_state *>(aRecord))
+      .store(aState, std::memory_order_release);
+  }
+
+  /**
+   * @brief Loads a record's state
+   * @param aRecord the record
+   * @return the state
+   */
+  static [[nodiscard]] type_state LoadState(uint8_t * aRecord) noexcept
+  {
+    return std::atomic_ref(*reinterpret_cast<type_state *>(aRecord))
+      .load(std::memory_order_acquire);
+  }
+};
+}  // namespace hbann
+
+#endif  // !ISTREAMABLE_RING_HPP